@@ -212,6 +212,9 @@ typedef enum {
     BGRX,        //!< BGRX color format with X ignored during inference
     NV12,        //!< NV12 color format represented as compound Y+UV blob
     I420,        //!< I420 color format represented as compound Y+U+V blob
+    YUYV,        //!< YUYV (YUY2) packed 4:2:2 color format represented as interleaved 2-channel blob
+    UYVY,        //!< UYVY packed 4:2:2 color format represented as interleaved 2-channel blob
+    P010,        //!< P010 10-bit color format represented as compound Y+UV blob of U16 planes
 } colorformat_e;
 
 /**
@@ -221,7 +224,8 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,    //!< "No resize" mode
     RESIZE_BILINEAR,  //!< "Bilinear resize" mode
-    RESIZE_AREA       //!< "Area resize" mode
+    RESIZE_AREA,      //!< "Area resize" mode
+    RESIZE_BICUBIC    //!< "Bicubic resize" mode
 } resize_alg_e;
 
 /**
@@ -110,7 +110,8 @@ std::map<IE::Layout, layout_e> layout_map = {{IE::Layout::ANY, layout_e::ANY},
 
 std::map<IE::ResizeAlgorithm, resize_alg_e> resize_alg_map = {{IE::ResizeAlgorithm::NO_RESIZE, resize_alg_e::NO_RESIZE},
                                                                 {IE::ResizeAlgorithm::RESIZE_AREA, resize_alg_e::RESIZE_AREA},
-                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR}};
+                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR},
+                                                                {IE::ResizeAlgorithm::RESIZE_BICUBIC, resize_alg_e::RESIZE_BICUBIC}};
 
 std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RAW, colorformat_e::RAW},
                                                             {IE::ColorFormat::RGB, colorformat_e::RGB},
@@ -118,7 +119,10 @@ std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RA
                                                             {IE::ColorFormat::BGRX, colorformat_e::BGRX},
                                                             {IE::ColorFormat::RGBX, colorformat_e::RGBX},
                                                             {IE::ColorFormat::NV12, colorformat_e::NV12},
-                                                            {IE::ColorFormat::I420, colorformat_e::I420}};
+                                                            {IE::ColorFormat::I420, colorformat_e::I420},
+                                                            {IE::ColorFormat::YUYV, colorformat_e::YUYV},
+                                                            {IE::ColorFormat::UYVY, colorformat_e::UYVY},
+                                                            {IE::ColorFormat::P010, colorformat_e::P010}};
 
 #define CATCH_IE_EXCEPTION(StatusCode, ExceptionType) catch (const IE::ExceptionType&) {return IEStatusCode::StatusCode;}
 
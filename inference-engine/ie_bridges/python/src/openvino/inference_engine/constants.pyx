@@ -61,6 +61,7 @@ class ResizeAlgorithm(Enum):
     NO_RESIZE = 0
     RESIZE_BILINEAR = 1
     RESIZE_AREA = 2
+    RESIZE_BICUBIC = 3
 
 
 class ColorFormat(Enum):
@@ -71,6 +72,9 @@ class ColorFormat(Enum):
     BGRX = 4
     NV12 = 5
     I420 = 6
+    YUYV = 7
+    UYVY = 8
+    P010 = 9
 
 
 cpdef enum StatusCode:
@@ -59,7 +59,9 @@ DECLARE_GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE);
 DECLARE_GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE_GENERATION);
 
 /**
-* @brief GNA proc_type setting that should be one of GNA_AUTO, GNA_HW, GNA_SW, GNA_SW_EXACT
+* @brief GNA proc_type setting that should be one of GNA_AUTO, GNA_HW, GNA_SW, GNA_SW_EXACT.
+* GNA_SW_FP32 runs not quantized network on CPU by the plugin, GNA_SW_EXACT_REF runs quantized network on CPU
+* by the plugin's bit exact emulation of GNA integer primitives, neither of them requires GNA library or device.
 */
 DECLARE_GNA_CONFIG_KEY(DEVICE_MODE);
 
@@ -68,6 +70,7 @@ DECLARE_GNA_CONFIG_VALUE(HW);
 DECLARE_GNA_CONFIG_VALUE(SW);
 DECLARE_GNA_CONFIG_VALUE(SW_EXACT);
 DECLARE_GNA_CONFIG_VALUE(SW_FP32);
+DECLARE_GNA_CONFIG_VALUE(SW_EXACT_REF);
 DECLARE_GNA_CONFIG_VALUE(GEN);
 DECLARE_GNA_CONFIG_VALUE(GEN_EXACT);
 DECLARE_GNA_CONFIG_VALUE(SSE);
@@ -98,6 +101,14 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 */
 DECLARE_GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT);
 
+/**
+* @brief The option to specify a directory where optimized PWL designs are persisted, so next network loads
+* (also in other processes) reuse them instead of designing PWL functions again. It may be the same directory as
+* the one passed in CACHE_DIR.
+* By default (in case of empty value), the designs are shared within a process only.
+*/
+DECLARE_GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR);
+
 /**
 * @brief By default, the GNA plugin uses one worker thread for inference computations.
 * This parameter allows you to create up to 127 threads for software modes.
@@ -146,6 +146,9 @@ enum ColorFormat : uint32_t {
     BGRX,      ///< BGRX color format with X ignored during inference
     NV12,      ///< NV12 color format represented as compound Y+UV blob
     I420,      ///< I420 color format represented as compound Y+U+V blob
+    YUYV,      ///< YUYV (YUY2) packed 4:2:2 color format represented as interleaved 2-channel blob
+    UYVY,      ///< UYVY packed 4:2:2 color format represented as interleaved 2-channel blob
+    P010,      ///< P010 10-bit color format represented as compound Y+UV blob of U16 planes
 };
 
 /**
@@ -168,6 +171,9 @@ inline std::ostream& operator<<(std::ostream& out, const ColorFormat& fmt) {
         PRINT_COLOR_FORMAT(BGRX);
         PRINT_COLOR_FORMAT(NV12);
         PRINT_COLOR_FORMAT(I420);
+        PRINT_COLOR_FORMAT(YUYV);
+        PRINT_COLOR_FORMAT(UYVY);
+        PRINT_COLOR_FORMAT(P010);
 #undef PRINT_COLOR_FORMAT
 
     default:
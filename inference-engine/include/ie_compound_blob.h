@@ -122,6 +122,8 @@ protected:
 
 /**
  * @brief Represents a blob that contains two planes (Y and UV) in NV12 color format
+ *
+ * Planes of U16 precision represent P010 color format: 10-bit samples stored in the high bits
  */
 class INFERENCE_ENGINE_API_CLASS(NV12Blob): public CompoundBlob {
 public:
@@ -47,7 +47,17 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_BICUBIC };
+
+/**
+ * @enum ResizeMode
+ * @brief Represents the way an input image is fitted into the network input by the resize
+ */
+enum class ResizeMode {
+    STRETCH = 0, /**< image is resized to the network input size, aspect ratio is not preserved */
+    LETTERBOX,   /**< image is resized preserving aspect ratio to fit the network input and centered in it,
+                      the rest of the input is filled with a pad value */
+};
 
 /**
  * @brief This class stores pre-process information for the input
@@ -60,6 +70,10 @@ class PreProcessInfo {
     // Resize Algorithm to be applied for input before inference if needed.
     ResizeAlgorithm _resizeAlg = NO_RESIZE;
 
+    // The way the input is fitted into the network input by the resize
+    ResizeMode _resizeMode = ResizeMode::STRETCH;
+    float _padValue = 0;
+
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
@@ -198,6 +212,37 @@ public:
         return _resizeAlg;
     }
 
+    /**
+     * @brief Sets the way the input is fitted into the network input by the resize
+     *
+     * Takes effect only if a resize algorithm is set
+     *
+     * @param mode Resize mode
+     * @param padValue Value the area not covered by the image is filled with in ResizeMode::LETTERBOX mode
+     */
+    void setResizeMode(ResizeMode mode, float padValue = 0) {
+        _resizeMode = mode;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Gets preconfigured resize mode
+     *
+     * @return Resize mode
+     */
+    ResizeMode getResizeMode() const {
+        return _resizeMode;
+    }
+
+    /**
+     * @brief Gets a value the area not covered by the image is filled with in ResizeMode::LETTERBOX mode
+     *
+     * @return Pad value
+     */
+    float getPadValue() const {
+        return _padValue;
+    }
+
     /**
      * @brief Changes the color format of the input data provided by the user
      *
@@ -40,6 +40,25 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for multi-model mode
+static const char models_message[] = "Optional. Enables multi-model mode: all listed models are loaded through one Core and run simultaneously, "
+                                     "each with its own infer requests. Format: \"<path1>[nireq=4,nstreams=2,qps=100],<path2>\", "
+                                     "the parameters in brackets are optional (qps enables open-loop mode for the model, nstreams is set for every device "
+                                     "of -d or for one of them as <device>:<nstreams>). "
+                                     "Every model is measured alone and then together with the others with the -t/-niter limits "
+                                     "to report the interference. Replaces -m, requires the async API.";
+/// @brief message for open-loop target rate
+static const char qps_message[] = "Optional. Enables open-loop mode: infer requests are submitted at the given rate (requests per second) "
+                                  "independently of completions, and the time spent waiting for an idle infer request is counted "
+                                  "as a part of latency. Requires the async API.";
+/// @brief message for open-loop arrival model
+static const char arrival_message[] = "Optional. Arrival model of the open-loop mode: \"poisson\" (default) or \"constant\" rate.";
+/// @brief message for latency SLO
+static const char slo_message[] = "Optional. Latency SLO in milliseconds. Enables a rate sweep in the open-loop mode which finds the maximum "
+                                  "rate meeting the SLO at the percentile set by -slo_percentile. Every step of the sweep runs with "
+                                  "the -t/-niter limits. Requires the async API.";
+/// @brief message for latency SLO percentile
+static const char slo_percentile_message[] = "Optional. Latency percentile checked against -slo. Default value is 99.";
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -95,6 +114,8 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for report_json option
+static const char report_json_message[] = "Optional. Store the statistics report in JSON format (benchmark_report.json) in addition to CSV.";
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
@@ -174,6 +195,16 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Models of the multi-model mode
+DEFINE_string(models, "", models_message);
+/// @brief Target rate of the open-loop mode (0 means closed loop)
+DEFINE_double(qps, 0.0, qps_message);
+/// @brief Arrival model of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+/// @brief Latency SLO in milliseconds for the rate sweep
+DEFINE_double(slo, 0.0, slo_message);
+/// @brief Latency percentile checked against the SLO
+DEFINE_double(slo_percentile, 99.0, slo_percentile_message);
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero
 /// cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
@@ -200,6 +231,8 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Enables statistics report in JSON format
+DEFINE_bool(report_json, false, report_json_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -262,6 +295,13 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << std::endl << "  Open-loop options:" << std::endl;
+    std::cout << "    -qps \"<double>\"           " << qps_message << std::endl;
+    std::cout << "    -arrival \"<model>\"        " << arrival_message << std::endl;
+    std::cout << "    -slo \"<double>\"           " << slo_message << std::endl;
+    std::cout << "    -slo_percentile \"<double>\" " << slo_percentile_message << std::endl;
+    std::cout << std::endl << "  Multi-model options:" << std::endl;
+    std::cout << "    -models \"<list>\"          " << models_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -270,6 +310,7 @@ static void showUsage() {
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -report_json              " << report_json_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
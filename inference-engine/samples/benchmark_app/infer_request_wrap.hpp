@@ -39,7 +39,13 @@ public:
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which arrived at the given time, the time before the start is reported as the queueing time
+    void startAsync(Time::time_point arrivalTime) {
         _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -49,6 +55,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -67,8 +74,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueTimeInMilliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -98,6 +111,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -107,6 +121,7 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueTimes.push_back(requests.at(id)->getQueueTimeInMilliseconds());
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -134,6 +149,11 @@ public:
         return _latencies;
     }
 
+    /// @brief Times between arrivals and starts of the requests, in the order of getLatencies()
+    std::vector<double> getQueueTimes() {
+        return _queueTimes;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,4 +163,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueTimes;
 };
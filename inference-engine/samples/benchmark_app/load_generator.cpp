@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_generator.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void collectResults(InferRequestsQueue& queue, RunResults& results) {
+    results.execTimes = queue.getLatencies();
+    results.queueTimes = queue.getQueueTimes();
+    results.latencies.resize(results.execTimes.size());
+    for (size_t i = 0; i < results.latencies.size(); i++)
+        results.latencies[i] = results.queueTimes[i] + results.execTimes[i];
+    results.duration = queue.getDurationInMilliseconds();
+}
+
+}  // namespace
+
+ArrivalModel parseArrivalModel(const std::string& model) {
+    if (model == "poisson")
+        return ArrivalModel::POISSON;
+    if (model == "constant")
+        return ArrivalModel::CONSTANT;
+    throw std::logic_error("Incorrect arrival model " + model + ". Please set -arrival option to `poisson` or `constant` value.");
+}
+
+RunResults runOpenLoop(InferRequestsQueue& queue, double qps, ArrivalModel model, uint64_t durationNanoseconds, size_t niter) {
+    if (qps <= 0.0)
+        throw std::logic_error("Target rate of the open-loop mode must be positive");
+
+    // fixed seed makes runs with the same parameters comparable
+    std::mt19937_64 generator(0);
+    std::exponential_distribution<double> interval(qps);
+    auto nextInterval = [&]() {
+        const double seconds = model == ArrivalModel::POISSON ? interval(generator) : 1.0 / qps;
+        return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+    };
+
+    RunResults results;
+    queue.resetTimes();
+    const auto startTime = Time::now();
+    auto arrivalTime = startTime;
+    while ((niter != 0 && results.iterations < niter) ||
+           (durationNanoseconds != 0 && static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrivalTime - startTime).count()) < durationNanoseconds)) {
+        std::this_thread::sleep_until(arrivalTime);
+
+        // blocks while all requests are busy: the arrival is queued and the following ones are overdue
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        inferRequest->wait();
+        inferRequest->startAsync(arrivalTime);
+        results.iterations++;
+
+        arrivalTime += nextInterval();
+    }
+    queue.waitAll();
+
+    collectResults(queue, results);
+    return results;
+}
+
+RunResults runClosedLoop(InferRequestsQueue& queue, uint64_t durationNanoseconds, size_t niter, bool sync, const ProgressCallback& progress) {
+    RunResults results;
+    queue.resetTimes();
+    const auto startTime = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    while ((niter != 0 && results.iterations < niter) || (durationNanoseconds != 0 && static_cast<uint64_t>(execTime) < durationNanoseconds) ||
+           (!sync && results.iterations % queue.requests.size() != 0)) {
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        if (sync) {
+            inferRequest->infer();
+        } else {
+            // As the inference request is currently idle, the wait() adds no
+            // additional overhead (and should return immediately). The primary
+            // reason for calling the method is exception checking/re-throwing.
+            // Callback, that governs the actual execution can handle errors as
+            // well, but as it uses just error codes it has no details like ‘what()’
+            // method of `std::exception` So, rechecking for any exceptions here.
+            inferRequest->wait();
+            inferRequest->startAsync();
+        }
+        results.iterations++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        if (progress)
+            progress(results.iterations, static_cast<uint64_t>(execTime));
+    }
+    queue.waitAll();
+
+    collectResults(queue, results);
+    return results;
+}
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Model of request arrivals for the open-loop mode
+enum class ArrivalModel {
+    POISSON,   // exponentially distributed intervals
+    CONSTANT,  // equal intervals
+};
+
+ArrivalModel parseArrivalModel(const std::string& model);
+
+/// @brief Results of the run, the times are in milliseconds
+struct RunResults {
+    std::vector<double> latencies;  // queueing + execution
+    std::vector<double> queueTimes;
+    std::vector<double> execTimes;
+    size_t iterations = 0;
+    double duration = 0.0;
+};
+
+/**
+ * @brief Submits requests at the target rate independently of completions (open loop).
+ * An arrival which finds no idle infer request waits in the queue and this time is a part of its latency,
+ * so an overloaded device shows growing latencies instead of a silently lowered rate.
+ * The run stops when the next arrival is beyond the duration limit or the number of iterations is reached.
+ */
+RunResults runOpenLoop(InferRequestsQueue& queue, double qps, ArrivalModel model, uint64_t durationNanoseconds, size_t niter);
+
+/// @brief Called after every iteration of the closed loop with the number of iterations and the elapsed nanoseconds
+using ProgressCallback = std::function<void(size_t, uint64_t)>;
+
+/**
+ * @brief Starts a new request as soon as one is completed (closed loop) with the async API, or runs the requests
+ * one by one with the sync API. For the async API the number of iterations is aligned by the number of requests,
+ * so the last requests are executed in the same conditions.
+ */
+RunResults runClosedLoop(InferRequestsQueue& queue, uint64_t durationNanoseconds, size_t niter, bool sync = false,
+                         const ProgressCallback& progress = nullptr);
@@ -20,6 +20,8 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "multi_model.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -47,11 +49,21 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models.empty()) {
         showUsage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_models.empty()) {
+        if (!FLAGS_m.empty()) {
+            throw std::logic_error("-m and -models options can't be used together.");
+        }
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Multi-model mode requires the async API. Please set -api option to `async` value.");
+        }
+        parseModelSpecs(FLAGS_models);
+    }
+
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -66,6 +78,20 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_qps < 0.0 || FLAGS_slo < 0.0) {
+        throw std::logic_error("Incorrect -qps or -slo option value. Please set a positive value.");
+    }
+
+    if ((FLAGS_qps > 0.0 || FLAGS_slo > 0.0) && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode and the SLO sweep require the async API. Please set -api option to `async` value.");
+    }
+
+    if (FLAGS_slo_percentile <= 0.0 || FLAGS_slo_percentile > 100.0) {
+        throw std::logic_error("Incorrect -slo_percentile option value. Please set a value in (0, 100] range.");
+    }
+
+    parseArrivalModel(FLAGS_arrival);
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -137,7 +163,7 @@ int main(int argc, char* argv[]) {
             }
         }
         if (!FLAGS_report_type.empty()) {
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config {FLAGS_report_type, FLAGS_report_folder});
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config {FLAGS_report_type, FLAGS_report_folder, FLAGS_report_json});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
         auto isFlagSetInCommandLine = [&command_line_arguments](const std::string& name) {
@@ -225,16 +251,10 @@ int main(int argc, char* argv[]) {
             perf_counts = (device_config.at(CONFIG_KEY(PERF_COUNT)) == CONFIG_VALUE(YES)) ? true : perf_counts;
 
             auto setThroughputStreams = [&]() {
-                const std::string key = device + "_THROUGHPUT_STREAMS";
+                const std::string key = getThroughputStreamsKey(device);
                 if (device_nstreams.count(device)) {
                     // set to user defined value
-                    std::vector<std::string> supported_config_keys = ie.GetMetric(device, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
-                    if (std::find(supported_config_keys.begin(), supported_config_keys.end(), key) == supported_config_keys.end()) {
-                        throw std::logic_error("Device " + device + " doesn't support config key '" + key + "'! " +
-                                               "Please specify -nstreams for correct devices in format  "
-                                               "<dev1>:<nstreams1>,<dev2>:<nstreams2>" +
-                                               " or via configuration file.");
-                    }
+                    checkThroughputStreamsSupport(ie, device);
                     device_config[key] = device_nstreams.at(device);
                 } else if (!device_config.count(key) && (FLAGS_api == "async")) {
                     slog::warn << "-nstreams default value is determined automatically for " << device
@@ -316,11 +336,16 @@ int main(int argc, char* argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
-        auto double_to_string = [](const double number) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(2) << number;
-            return ss.str();
-        };
+        if (!FLAGS_models.empty()) {
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : (FLAGS_niter == 0 ? deviceDefaultDeviceDurationInSeconds(device_name) : 0);
+            next_step("multi-model mode, skipping the steps for a single model");
+            runMultiModel(ie, device_name, parseModelSpecs(FLAGS_models), getDurationInNanoseconds(duration_seconds), FLAGS_niter,
+                          parseArrivalModel(FLAGS_arrival), statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto get_total_ms_time = [](Time::time_point& startTime) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
@@ -427,7 +452,7 @@ int main(int argc, char* argv[]) {
 
         // Update number of streams
         for (auto&& ds : device_nstreams) {
-            const std::string key = ds.first + "_THROUGHPUT_STREAMS";
+            const std::string key = getThroughputStreamsKey(ds.first);
             device_nstreams[ds.first] = ie.GetConfig(ds.first, key).as<std::string>();
         }
 
@@ -535,6 +560,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (FLAGS_qps > 0.0) {
+            ss << ", open loop: " << FLAGS_qps << " requests per second, " << FLAGS_arrival << " arrivals";
+        }
         next_step(ss.str());
 
         // warming up - out of scope
@@ -554,57 +582,38 @@ int main(int argc, char* argv[]) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"first inference time (ms)", duration_ms}});
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
+        RunResults runResults;
+        if (FLAGS_qps > 0.0) {
+            runResults = runOpenLoop(inferRequestsQueue, FLAGS_qps, parseArrivalModel(FLAGS_arrival), duration_nanoseconds, niter);
+        } else {
+            runResults = runClosedLoop(inferRequestsQueue, duration_nanoseconds, niter, FLAGS_api == "sync", [&](size_t, uint64_t execTime) {
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
+            });
         }
+        iteration = runResults.iterations;
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
-
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
+        // in the open-loop mode the latency includes the time spent in the queue
+        auto latencies = FLAGS_qps > 0.0 ? runResults.latencies : runResults.execTimes;
+        double latency = getMedianValue<double>(latencies);
+        double totalDuration = runResults.duration;
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        LatencyMetrics latencyMetrics(latencies);
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
@@ -615,12 +624,78 @@ int main(int argc, char* argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                              {"latency (ms)", double_to_string(latency)},
                                                                                          });
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, latencyMetrics.toParameters("latency"));
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
+            if (FLAGS_qps > 0.0) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                             {"target rate (qps)", double_to_string(FLAGS_qps)},
+                                                                                             {"arrival model", FLAGS_arrival},
+                                                                                         });
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          LatencyMetrics(runResults.queueTimes).toParameters("queueing time"));
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          LatencyMetrics(runResults.execTimes).toParameters("execution time"));
+            }
         }
 
         progressBar.finish();
 
+        // Sweep of the open-loop rate: doubling while the SLO is met, then bisection of the last interval
+        double maxSloRate = 0.0;
+        if (FLAGS_slo > 0.0) {
+            static const size_t sweepGrowSteps = 5;
+            static const size_t sweepBisectionSteps = 6;
+            const auto arrivalModel = parseArrivalModel(FLAGS_arrival);
+            // starts from the requested rate or from the throughput measured in the closed loop
+            double rate = FLAGS_qps > 0.0 ? FLAGS_qps : iteration * 1000.0 / totalDuration;
+            double low = 0.0, high = 0.0;
+
+            auto meetsSlo = [&](double stepRate) {
+                auto results = runOpenLoop(inferRequestsQueue, stepRate, arrivalModel, duration_nanoseconds, niter);
+                LatencyMetrics metrics(results.latencies);
+                std::vector<double> sorted(results.latencies);
+                std::sort(sorted.begin(), sorted.end());
+                const double percentile = LatencyMetrics::percentile(sorted, FLAGS_slo_percentile);
+                const bool passed = percentile <= FLAGS_slo;
+                slog::info << "SLO sweep: " << double_to_string(stepRate) << " qps, p" << FLAGS_slo_percentile << " latency "
+                           << double_to_string(percentile) << " ms, median " << double_to_string(metrics.median) << " ms: "
+                           << (passed ? "meets" : "violates") << " SLO of " << double_to_string(FLAGS_slo) << " ms" << slog::endl;
+                if (statistics) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {{"slo sweep " + double_to_string(stepRate) + " qps latency (ms)", double_to_string(percentile)}});
+                }
+                return passed;
+            };
+
+            for (size_t step = 0; step < sweepGrowSteps; step++, rate *= 2) {
+                if (!meetsSlo(rate)) {
+                    high = rate;
+                    break;
+                }
+                low = rate;
+            }
+            if (high == 0.0) {
+                slog::warn << "SLO is met at the highest tested rate, the maximum rate may be higher" << slog::endl;
+            } else {
+                for (size_t step = 0; step < sweepBisectionSteps; step++) {
+                    const double middle = (low + high) / 2;
+                    if (meetsSlo(middle))
+                        low = middle;
+                    else
+                        high = middle;
+                }
+            }
+            maxSloRate = low;
+            if (statistics) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                             {"latency SLO (ms)", double_to_string(FLAGS_slo)},
+                                                                                             {"latency SLO percentile", double_to_string(FLAGS_slo_percentile)},
+                                                                                             {"max rate meeting SLO (qps)", double_to_string(maxSloRate)},
+                                                                                         });
+            }
+        }
+
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -665,6 +740,14 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos)
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (device_name.find("MULTI") == std::string::npos)
+            latencyMetrics.print(std::cout, "Latency");
+        if (FLAGS_qps > 0.0) {
+            LatencyMetrics(runResults.queueTimes).print(std::cout, "Queueing time");
+            LatencyMetrics(runResults.execTimes).print(std::cout, "Execution time");
+        }
+        if (FLAGS_slo > 0.0)
+            std::cout << "Max rate meeting SLO: " << double_to_string(maxSloRate) << " QPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_model.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct LoadedModel {
+    ModelSpec spec;
+    std::string name;
+    ExecutableNetwork network;
+    size_t batchSize = 1;
+    std::unique_ptr<InferRequestsQueue> queue;
+};
+
+void parseModelParameter(ModelSpec& spec, const std::string& parameter) {
+    auto pos = parameter.find('=');
+    if (pos == std::string::npos)
+        throw std::logic_error("Can't parse parameter " + parameter + " of the model " + spec.path + ". Expected <name>=<value> format.");
+    const std::string name = parameter.substr(0, pos);
+    const std::string value = parameter.substr(pos + 1);
+    if (name == "nireq") {
+        spec.nireq = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "nstreams") {
+        spec.nstreams = value;
+    } else if (name == "qps") {
+        spec.qps = std::stod(value);
+        if (spec.qps < 0.0)
+            throw std::logic_error("Target rate of the model " + spec.path + " must be positive");
+    } else {
+        throw std::logic_error("Unknown parameter " + name + " of the model " + spec.path + ". Expected nireq, nstreams or qps.");
+    }
+}
+
+LoadedModel loadModel(Core& ie, const std::string& device, const ModelSpec& spec) {
+    LoadedModel model;
+    model.spec = spec;
+
+    std::map<std::string, std::string> config;
+    if (!spec.nstreams.empty()) {
+        // devices are parsed as for -nstreams, MULTI and HETERO pass the key of each device to this device
+        const auto devices = parseDevices(device);
+        if (devices.empty())
+            throw std::logic_error("Can't set nstreams of the model " + spec.path + ": no devices are listed in " + device);
+        for (const auto& deviceStreams : parseNStreamsValuePerDevice(devices, spec.nstreams)) {
+            checkThroughputStreamsSupport(ie, deviceStreams.first);
+            config[getThroughputStreamsKey(deviceStreams.first)] = deviceStreams.second;
+        }
+    }
+
+    benchmark_app::InputsInfo inputsInfo;
+    if (fileExt(spec.path) == "blob") {
+        model.network = ie.ImportNetwork(spec.path, device, config);
+        inputsInfo = getInputsInfo<InputInfo::CPtr>("", "", 0, model.network.GetInputsInfo());
+        model.name = fileNameNoExt(spec.path);
+    } else {
+        CNNNetwork cnnNetwork = ie.ReadNetwork(spec.path);
+        inputsInfo = getInputsInfo<InputInfo::Ptr>("", "", 0, cnnNetwork.getInputsInfo());
+        for (auto& item : cnnNetwork.getInputsInfo()) {
+            if (inputsInfo.at(item.first).isImage()) {
+                inputsInfo.at(item.first).precision = Precision::U8;
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+        model.batchSize = cnnNetwork.getBatchSize();
+        model.name = cnnNetwork.getName();
+        model.network = ie.LoadNetwork(cnnNetwork, device, config);
+    }
+
+    uint32_t nireq = spec.nireq;
+    if (nireq == 0)
+        nireq = model.network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    model.queue.reset(new InferRequestsQueue(model.network, nireq));
+    fillBlobs({}, model.batchSize, inputsInfo, model.queue->requests);
+    return model;
+}
+
+RunResults runModel(LoadedModel& model, uint64_t durationNanoseconds, size_t niter, ArrivalModel arrivalModel) {
+    if (model.spec.qps > 0.0)
+        return runOpenLoop(*model.queue, model.spec.qps, arrivalModel, durationNanoseconds, niter);
+    return runClosedLoop(*model.queue, durationNanoseconds, niter);
+}
+
+double throughput(const LoadedModel& model, const RunResults& results) {
+    return results.duration > 0.0 ? model.batchSize * 1000.0 * results.iterations / results.duration : 0.0;
+}
+
+}  // namespace
+
+std::vector<ModelSpec> parseModelSpecs(const std::string& models) {
+    std::vector<ModelSpec> specs;
+    size_t pos = 0;
+    while (pos < models.size()) {
+        ModelSpec spec;
+        const size_t end = models.find_first_of("[,", pos);
+        spec.path = models.substr(pos, end - pos);
+        pos = end;
+        if (pos != std::string::npos && models[pos] == '[') {
+            const size_t close = models.find(']', pos);
+            if (close == std::string::npos)
+                throw std::logic_error("Can't parse -models parameter: missing ']' for the model " + spec.path);
+            for (auto& parameter : split(models.substr(pos + 1, close - pos - 1), ',')) {
+                if (!parameter.empty())
+                    parseModelParameter(spec, parameter);
+            }
+            pos = close + 1;
+        }
+        if (pos != std::string::npos && pos < models.size() && models[pos] != ',')
+            throw std::logic_error("Can't parse -models parameter: unexpected symbols after the model " + spec.path);
+        if (spec.path.empty())
+            throw std::logic_error("Can't parse -models parameter: empty model path");
+        specs.push_back(spec);
+        pos = pos == std::string::npos ? models.size() : pos + 1;
+    }
+    if (specs.empty())
+        throw std::logic_error("No models are specified in -models parameter");
+    return specs;
+}
+
+void runMultiModel(Core& ie, const std::string& device, const std::vector<ModelSpec>& specs, uint64_t durationNanoseconds, size_t niter,
+                   ArrivalModel arrivalModel, const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<LoadedModel> models;
+    std::set<std::string> names;
+    for (const auto& spec : specs) {
+        slog::info << "Loading " << spec.path << slog::endl;
+        models.push_back(loadModel(ie, device, spec));
+        // the same model may be loaded several times with different parameters
+        auto& name = models.back().name;
+        if (!names.insert(name).second) {
+            name += "_" + std::to_string(models.size() - 1);
+            names.insert(name);
+        }
+    }
+
+    // warming up - out of scope
+    for (auto& model : models) {
+        auto inferRequest = model.queue->getIdleRequest();
+        inferRequest->startAsync();
+        model.queue->waitAll();
+    }
+
+    std::vector<RunResults> solo;
+    for (auto& model : models) {
+        slog::info << "Measuring " << model.name << " alone" << slog::endl;
+        solo.push_back(runModel(model, durationNanoseconds, niter, arrivalModel));
+    }
+
+    slog::info << "Measuring " << models.size() << " models simultaneously" << slog::endl;
+    std::vector<RunResults> concurrent(models.size());
+    std::vector<std::exception_ptr> errors(models.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < models.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                concurrent[i] = runModel(models[i], durationNanoseconds, niter, arrivalModel);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::cout << std::endl
+              << std::left << std::setw(32) << "Model" << std::right << std::setw(12) << "solo FPS" << std::setw(12) << "FPS" << std::setw(10) << "ratio"
+              << std::setw(14) << "solo p99 ms" << std::setw(10) << "p50 ms" << std::setw(10) << "p99 ms" << std::setw(10) << "ratio" << std::endl;
+    for (size_t i = 0; i < models.size(); i++) {
+        const auto& model = models[i];
+        const double soloFps = throughput(model, solo[i]);
+        const double fps = throughput(model, concurrent[i]);
+        const LatencyMetrics soloLatency(solo[i].latencies);
+        const LatencyMetrics latency(concurrent[i].latencies);
+        const double fpsRatio = soloFps > 0.0 ? fps / soloFps : 0.0;
+        const double p99Ratio = soloLatency.p99 > 0.0 ? latency.p99 / soloLatency.p99 : 0.0;
+
+        std::cout << std::left << std::setw(32) << model.name << std::right << std::setw(12) << double_to_string(soloFps) << std::setw(12)
+                  << double_to_string(fps) << std::setw(10) << double_to_string(fpsRatio) << std::setw(14) << double_to_string(soloLatency.p99)
+                  << std::setw(10) << double_to_string(latency.median) << std::setw(10) << double_to_string(latency.p99) << std::setw(10)
+                  << double_to_string(p99Ratio) << std::endl;
+
+        if (statistics) {
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                         {model.name + " path", model.spec.path},
+                                                                                         {model.name + " infer requests", std::to_string(model.queue->requests.size())},
+                                                                                         {model.name + " target rate (qps)", double_to_string(model.spec.qps)},
+                                                                                         {model.name + " solo throughput", double_to_string(soloFps)},
+                                                                                         {model.name + " throughput", double_to_string(fps)},
+                                                                                         {model.name + " throughput ratio to solo", double_to_string(fpsRatio)},
+                                                                                         {model.name + " p99 latency ratio to solo", double_to_string(p99Ratio)},
+                                                                                     });
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, soloLatency.toParameters(model.name + " solo latency"));
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, latency.toParameters(model.name + " latency"));
+        }
+    }
+}
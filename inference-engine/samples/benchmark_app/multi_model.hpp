@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <inference_engine.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "load_generator.hpp"
+#include "statistics_report.hpp"
+
+/// @brief Model of the multi-model mode with its own load parameters
+struct ModelSpec {
+    std::string path;
+    uint32_t nireq = 0;    // 0 - optimal number of requests for the device
+    std::string nstreams;  // empty - streams set in the device configuration
+    double qps = 0.0;      // 0 - closed loop
+};
+
+/// @brief Parses the list of models in "<path1>[nireq=4,nstreams=2,qps=100],<path2>" format, the parameters are optional
+std::vector<ModelSpec> parseModelSpecs(const std::string& models);
+
+/**
+ * @brief Loads all models to the device through one Core and measures every model alone and then all models
+ * simultaneously. Reports throughput and latency percentiles of each model in both cases, and the ratio between
+ * them, which shows the interference of the models sharing the device.
+ */
+void runMultiModel(InferenceEngine::Core& ie, const std::string& device, const std::vector<ModelSpec>& specs, uint64_t durationNanoseconds, size_t niter,
+                   ArrivalModel arrivalModel, const std::shared_ptr<StatisticsReport>& statistics);
@@ -5,11 +5,18 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <map>
+#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "utils.hpp"
+
 void StatisticsReport::addParameters(const Category& category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -51,6 +58,61 @@ void StatisticsReport::dump() {
     }
 
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+
+    if (_config.report_json)
+        dumpJson();
+}
+
+void StatisticsReport::dumpJson() {
+    const std::string filename = _config.report_folder + _separator + "benchmark_report.json";
+    std::ofstream out(filename);
+    if (!out.is_open())
+        throw std::runtime_error("Can't open file " + filename + " to store the statistics report");
+
+    auto quote = [](const std::string& str) {
+        std::string result = "\"";
+        for (char c : str) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(c));
+                result += code;
+            } else {
+                result += c;
+            }
+        }
+        return result + "\"";
+    };
+    // numbers are stored as numbers, so the report can be processed without conversions
+    const std::regex number(R"(-?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?)");
+    auto value = [&](const std::string& str) {
+        return std::regex_match(str, number) ? str : quote(str);
+    };
+
+    const std::vector<std::pair<Category, std::string>> sections = {
+        {Category::COMMAND_LINE_PARAMETERS, "command_line_parameters"},
+        {Category::RUNTIME_CONFIG, "configuration_setup"},
+        {Category::EXECUTION_RESULTS, "execution_results"},
+    };
+    out << "{";
+    bool firstSection = true;
+    for (const auto& section : sections) {
+        if (!_parameters.count(section.first))
+            continue;
+        out << (firstSection ? "" : ",") << "\n  " << quote(section.second) << ": {";
+        firstSection = false;
+        bool firstParameter = true;
+        for (const auto& parameter : _parameters.at(section.first)) {
+            out << (firstParameter ? "" : ",") << "\n    " << quote(parameter.first) << ": " << value(parameter.second);
+            firstParameter = false;
+        }
+        out << "\n  }";
+    }
+    out << "\n}\n";
+
+    slog::info << "Statistics report is stored to " << filename << slog::endl;
 }
 
 void StatisticsReport::dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts) {
@@ -141,3 +203,75 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies, size_t histogramBins) {
+    if (latencies.empty())
+        return;
+
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    count = sorted.size();
+    double sum = 0.0;
+    for (auto latency : sorted)
+        sum += latency;
+    avg = sum / count;
+    min = sorted.front();
+    max = sorted.back();
+    median = percentile(sorted, 50);
+    p90 = percentile(sorted, 90);
+    p99 = percentile(sorted, 99);
+    p999 = percentile(sorted, 99.9);
+
+    // log-spaced bins show both the body and the tail of the distribution
+    const double low = std::max(min, 1e-3);
+    if (histogramBins < 2 || max <= low) {
+        histogram.emplace_back(max, count);
+        return;
+    }
+    const double ratio = std::pow(max / low, 1.0 / histogramBins);
+    double bound = low;
+    auto it = sorted.begin();
+    for (size_t bin = 0; bin < histogramBins; bin++) {
+        bound = (bin + 1 == histogramBins) ? max : bound * ratio;
+        auto next = std::upper_bound(it, sorted.end(), bound);
+        histogram.emplace_back(bound, static_cast<size_t>(next - it));
+        it = next;
+    }
+}
+
+double LatencyMetrics::percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0.0;
+    const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+StatisticsReport::Parameters LatencyMetrics::toParameters(const std::string& name) const {
+    StatisticsReport::Parameters parameters = {
+        {name + " avg (ms)", double_to_string(avg)},
+        {name + " min (ms)", double_to_string(min)},
+        {name + " median (ms)", double_to_string(median)},
+        {name + " p90 (ms)", double_to_string(p90)},
+        {name + " p99 (ms)", double_to_string(p99)},
+        {name + " p99.9 (ms)", double_to_string(p999)},
+        {name + " max (ms)", double_to_string(max)},
+    };
+    for (const auto& bin : histogram)
+        parameters.push_back({name + " histogram <= " + double_to_string(bin.first) + " ms", std::to_string(bin.second)});
+    return parameters;
+}
+
+void LatencyMetrics::print(std::ostream& out, const std::string& name) const {
+    out << name << " (ms): avg " << double_to_string(avg) << ", min " << double_to_string(min) << ", median " << double_to_string(median)
+        << ", p90 " << double_to_string(p90) << ", p99 " << double_to_string(p99) << ", p99.9 " << double_to_string(p999) << ", max "
+        << double_to_string(max) << std::endl;
+
+    size_t maxCount = 1;
+    for (const auto& bin : histogram)
+        maxCount = std::max(maxCount, bin.second);
+    static const size_t barWidth = 40;
+    for (const auto& bin : histogram) {
+        out << "    <= " << std::setw(10) << double_to_string(bin.first) << " ms " << std::setw(8) << bin.second << " "
+            << std::string(bin.second * barWidth / maxCount, '#') << std::endl;
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <inference_engine.hpp>
 #include <map>
+#include <ostream>
 #include <samples/common.hpp>
 #include <samples/csv_dumper.hpp>
 #include <samples/slog.hpp>
@@ -27,6 +28,7 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        bool report_json;
     };
 
     enum class Category {
@@ -57,6 +59,8 @@ public:
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
 
 private:
+    void dumpJson();
+
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
     // configuration of current benchmark execution
@@ -68,3 +72,29 @@ private:
     // csv separator
     std::string _separator;
 };
+
+/// @brief Distribution of latencies in milliseconds
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies, size_t histogramBins = 10);
+
+    /// @brief Parameters for the statistics report, the names are prefixed by the given name
+    StatisticsReport::Parameters toParameters(const std::string& name) const;
+
+    void print(std::ostream& out, const std::string& name) const;
+
+    size_t count = 0;
+    double avg = 0.0;
+    double min = 0.0;
+    double median = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+
+    // upper bounds of log-spaced bins and the number of latencies in each bin
+    std::vector<std::pair<double, size_t>> histogram;
+
+    /// @brief Nearest-rank percentile of sorted values, p is in [0, 100]
+    static double percentile(const std::vector<double>& sorted, double p);
+};
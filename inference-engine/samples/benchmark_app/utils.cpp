@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <regex>
@@ -89,6 +90,12 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     if (comma_separated_devices.find(":") != std::string::npos) {
@@ -129,6 +136,21 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
     return result;
 }
 
+std::string getThroughputStreamsKey(const std::string& device) {
+    return device + "_THROUGHPUT_STREAMS";
+}
+
+void checkThroughputStreamsSupport(InferenceEngine::Core& ie, const std::string& device) {
+    const std::string key = getThroughputStreamsKey(device);
+    std::vector<std::string> supported_config_keys = ie.GetMetric(device, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(supported_config_keys.begin(), supported_config_keys.end(), key) == supported_config_keys.end()) {
+        throw std::logic_error("Device " + device + " doesn't support config key '" + key + "'! " +
+                               "Please specify -nstreams for correct devices in format  "
+                               "<dev1>:<nstreams1>,<dev2>:<nstreams2>" +
+                               " or via configuration file.");
+    }
+}
+
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info) {
     size_t batch_size = 0;
     for (auto& info : inputs_info) {
@@ -16,6 +16,7 @@ struct GNAFlags {
     float pwlMaxErrorPercent = 1.0f;
     bool gna_openmp_multithreading = false;
     bool sw_fp32 = false;
+    bool sw_exact_ref = false;
     bool fake_quantized = false;
     bool performance_counting = false;
     bool input_low_precision = false;
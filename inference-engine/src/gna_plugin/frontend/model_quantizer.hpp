@@ -5,13 +5,18 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include <utility>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <exception>
 
 #include <legacy/layer_transform.hpp>
 #include "gna_graph_tools.hpp"
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <ie_parallel.hpp>
+#include "gna_itt.hpp"
 #include "layer_quantizer.hpp"
 #include "scale_factor_calc.hpp"
 #include "weights_converter.hpp"
@@ -24,7 +29,14 @@ namespace GNAPluginNS {
  */
 template<class T>
 class ModelQuantizer {
+    bool parallel;
+
  public:
+    /**
+     * @param parallel - whether layers independent from each other are quantized concurrently, results are the same
+     */
+    explicit ModelQuantizer(bool parallel = true) : parallel(parallel) {}
+
     InferenceEngine::CNNNetwork quantize(const InferenceEngine::CNNNetwork &model, float scaleFactor) const {
         return quantize(model, [](const InferenceEngine::CNNNetwork &, bool runBeforeCopy, bool lowPrecision){}, std::vector<float>({scaleFactor}));
     }
@@ -40,6 +52,7 @@ class ModelQuantizer {
 
     template <class PreQuantisationCb>
     InferenceEngine::CNNNetwork quantize(const InferenceEngine::CNNNetwork &model, const PreQuantisationCb &cb, std::vector<float> scaleFactor) const {
+        OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::quantize");
         auto visitor = [&](InferenceEngine::CNNLayerPtr lp) {
             auto newLayer = InferenceEngine::injectData<QuantizedLayerParams>(lp);
             transformLayer(newLayer, WeightsConverter());
@@ -86,16 +99,61 @@ class ModelQuantizer {
                              T::mandatory().getInputPrecision().size(), isFakeQuantize);
 
         // sorted order gives possibility for propagate quantisation along depended layers
-        for (auto &&layer : sortedNewNet) {
-            transformLayer(layer, lc);
+        OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::quantizeLayers");
+        for (auto &&level : getLevels(sortedNewNet)) {
+            if (!parallel) {
+                for (auto &&layer : level) {
+                    transformLayer(layer, lc);
+                }
+                continue;
+            }
+            std::vector<std::exception_ptr> errors(level.size());
+            InferenceEngine::parallel_for(level.size(), [&](size_t i) {
+                try {
+                    transformLayer(level[i], lc);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+            for (auto &&error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
         }
 
         return copiedNet;
     }
 
  private :
+    /**
+     * @brief splits sorted layers into levels, where each layer depends only on layers from previous levels,
+     * so layers of a level are quantized independently
+     */
+    static std::vector<std::vector<InferenceEngine::CNNLayerPtr>> getLevels(const std::vector<InferenceEngine::CNNLayerPtr> & sortedLayers) {
+        std::vector<std::vector<InferenceEngine::CNNLayerPtr>> levels;
+        std::unordered_map<InferenceEngine::CNNLayer *, size_t> layerLevel;
+        for (auto &&layer : sortedLayers) {
+            size_t level = 0;
+            for (auto &&input : layer->insData) {
+                auto creator = getCreatorLayer(input.lock()).lock();
+                auto creatorLevel = creator ? layerLevel.find(creator.get()) : layerLevel.end();
+                if (creatorLevel != layerLevel.end()) {
+                    level = std::max(level, creatorLevel->second + 1);
+                }
+            }
+            layerLevel[layer.get()] = level;
+            if (levels.size() <= level) {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(layer);
+        }
+        return levels;
+    }
+
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net, int mandWeightsBytesSize,
                               int optWeightsBytesSize, int inputsBytesSize, bool fakeQuantize) const {
+        OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::propagateScaleFactor");
         ScaleFactorCalculator sf(net, mandWeightsBytesSize, optWeightsBytesSize, inputsBytesSize, fakeQuantize);
 
         while (!sf.allLayersProcessed()) {
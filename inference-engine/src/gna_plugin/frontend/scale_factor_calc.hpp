@@ -10,6 +10,7 @@
 #include <limits>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <legacy/ie_layers.h>
 #include "gna_upstream_iterator.hpp"
@@ -1196,12 +1197,28 @@ class ScaleFactorCalculator {
     int optWeightsBytesSize;
     bool isFakeQuantize;
     int inputsBytesSize;
+    // position of every layer in net, restarts happen often on large models, so they shouldn't search the layer
+    std::unordered_map<InferenceEngine::CNNLayer *, size_t> positions;
 
  public:
+    /**
+     * @brief range of layers still to be processed, it refers to calculator's own layers without copying them
+     */
+    struct LayersRange {
+        Cnt::const_iterator first;
+        Cnt::const_iterator last;
+        Cnt::const_iterator begin() const { return first; }
+        Cnt::const_iterator end() const { return last; }
+    };
+
     ScaleFactorCalculator(Cnt &net, int mandWeightsBytesSize, int optWeightsBytesSize, int inputsBytesSize, bool fakeQuantize)
             : net(net), mandWeightsBytesSize(mandWeightsBytesSize), optWeightsBytesSize(optWeightsBytesSize),
               inputsBytesSize(inputsBytesSize), isFakeQuantize(fakeQuantize) {
         idx = std::begin(this->net);
+        positions.reserve(this->net.size());
+        for (size_t i = 0; i < this->net.size(); i++) {
+            positions.emplace(this->net[i].get(), i);
+        }
     }
     bool needToRestart() const {
         return needRestart;
@@ -1209,8 +1226,8 @@ class ScaleFactorCalculator {
     bool allLayersProcessed() const {
         return idx == std::end(net);
     }
-    std::vector<InferenceEngine::CNNLayerPtr> getStartLayers() const {
-        return std::vector<InferenceEngine::CNNLayerPtr>(idx, std::end(net));
+    LayersRange getStartLayers() const {
+        return {idx, std::end(net)};
     }
     template<class T>
     bool operator()(T ptr) const {
@@ -1230,14 +1247,11 @@ class ScaleFactorCalculator {
             return true;
         }
 
-        idx = std::find_if(net.begin(), net.end(), [&](InferenceEngine::CNNLayerPtr cnnLayer) {
-            if (!result) {
-                return result.restartLayer == cnnLayer.get();
-            }
-            return ptr == cnnLayer.get();
-        });
-        if (idx != net.end()) {
-            idx++;
+        auto position = positions.find(result.restartLayer);
+        if (position != positions.end()) {
+            idx = std::next(net.begin(), position->second + 1);
+        } else {
+            idx = net.end();
         }
         needRestart = true;
         return true;
@@ -94,11 +94,17 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkInternal {
         if (old_mode == InferenceEngine::GNAConfigParams::GNA_SW_FP32) {
             IE_THROW() << "Dynamic switching from GNA_SW_FP32 mode is not supported for ExecutableNetwork.";
         }
+        if (old_mode == InferenceEngine::GNAConfigParams::GNA_SW_EXACT_REF) {
+            IE_THROW() << "Dynamic switching from GNA_SW_EXACT_REF mode is not supported for ExecutableNetwork.";
+        }
 
         auto new_mode = config.begin()->second.as<std::string>();
         if (new_mode == InferenceEngine::GNAConfigParams::GNA_SW_FP32) {
             IE_THROW() << "Dynamic switching to GNA_SW_FP32 mode is not supported for ExecutableNetwork.";
         }
+        if (new_mode == InferenceEngine::GNAConfigParams::GNA_SW_EXACT_REF) {
+            IE_THROW() << "Dynamic switching to GNA_SW_EXACT_REF mode is not supported for ExecutableNetwork.";
+        }
 
         std::map<std::string, std::string> configForPlugin;
         configForPlugin[KEY_GNA_DEVICE_MODE] = new_mode;
@@ -23,6 +23,7 @@
 #include <legacy/net_pass.h>
 #include <debug.h>
 #include <gna/gna_config.hpp>
+#include <file_utils.h>
 #include "gna_plugin_config.hpp"
 #include "gna_plugin.hpp"
 #include "optimizer/gna_pass_manager.hpp"
@@ -36,6 +37,8 @@
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
 #include "runtime/gna_float_runtime.hpp"
+#include "runtime/gna_integer_runtime.hpp"
+#include "runtime/pwl_design_cache.hpp"
 #include <layers/gna_fake_quantize_layer.hpp>
 #include "gna_graph_patterns.hpp"
 #include "gna_tensor_tools.hpp"
@@ -315,7 +318,7 @@ void GNAPlugin::ImportFrames(
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
             }
         } else if (input_precision.size() == 4) {
-            if (!gnadevice) {
+            if (gnaFlags->sw_fp32) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
@@ -333,7 +336,7 @@ void GNAPlugin::ImportFrames(
     } else {
         if (input_precision == Precision::U8) {
             auto src = reinterpret_cast<const uint8_t *>(ptr_src);
-            if (!gnadevice) {
+            if (gnaFlags->sw_fp32) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
             } else if (!gnaFlags->input_low_precision) {
@@ -353,7 +356,7 @@ void GNAPlugin::ImportFrames(
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
             }
         } else if (input_precision.size() == 4) {
-            if (!gnadevice) {
+            if (gnaFlags->sw_fp32) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
@@ -843,7 +846,7 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         gnaFlags->gna_lib_async_threads_num = 1;
     }
 
-    if (gnaFlags->sw_fp32) {
+    if (gnaFlags->sw_fp32 || gnaFlags->sw_exact_ref) {
         gnamem.reset(new gna_memory_type(memory::make_polymorph<std::allocator<uint8_t>>()));
         graphCompiler.setGNAMemoryPtr(gnamem);
     } else {
@@ -866,11 +869,23 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         inputsDesc->getPtrInputsGlobal(input.first).resize(gnaFlags->gna_lib_async_threads_num);
     }
 
+    // PWL designs persisted by previous loads are reused by activation layers
+    std::string pwlDesignCachePath;
+    if (!config.pwlDesignCacheDir.empty()) {
+        FileUtils::createDirectoryRecursive(config.pwlDesignCacheDir);
+        pwlDesignCachePath = FileUtils::makePath(config.pwlDesignCacheDir, std::string("gna_pwl_designs.bin"));
+        runtime::PwlDesignCache::instance().load(pwlDesignCachePath);
+    }
+
     // CreatingLayer primitives
     for (auto & layer : sortedNoMem) {
         graphCompiler.CreateLayerPrimitive(layer);
     }
 
+    if (!pwlDesignCachePath.empty()) {
+        runtime::PwlDesignCache::instance().save(pwlDesignCachePath);
+    }
+
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
         if (layerInfo.isInput() && 0 == inputsDesc->bytes_allocated_for_input[inputLayer->name]) {
@@ -1242,14 +1257,19 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
                                     << ") do not match input buffer length of " << elementsPerBatch;
             }
             auto input_ptr = reinterpret_cast<uint8_t *>(inputsDesc->getPtrInputsGlobal(input.first)[idx]);
-            ConvertTensorFromNCHWToNHWC(gnadevice ? 2 : 4, batchSize, elementsPerBatch, input_ptr, true, transpose_info->second);
+            ConvertTensorFromNCHWToNHWC(gnaFlags->sw_fp32 ? 4 : 2, batchSize, elementsPerBatch, input_ptr, true, transpose_info->second);
         }
         ++inputNum;
     }
-    // If there is no gnadevice infer using reference FP32 transforamtions
+    // If there is no gnadevice infer using reference FP32 or integer transforamtions
     if (!gnadevice || trivialTopology) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
+        if (gnaFlags->sw_exact_ref) {
+            auto runtime = runtime::Integer(dnn);
+            runtime.infer();
+        } else {
+            auto runtime = runtime::FP(dnn);
+            runtime.infer();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -1363,7 +1383,7 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
                         outputDesc.num_bytes_per_element,
                         sizeof(float));
 
-        if (gnadevice) {
+        if (!gnaFlags->sw_fp32) {
 #ifdef PLOT
             FILE* f = nullptr;
             static int num_infers = 0;
@@ -1479,6 +1499,9 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
 InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::istream& networkModel) {
     auto header = GNAModelSerial::ReadHeader(networkModel);
 
+    if (gnaFlags->sw_exact_ref) {
+        THROW_GNA_EXCEPTION << "Import of the network is not supported on GNA_SW_EXACT_REF";
+    }
     InitGNADevice();
 
     graphCompiler.setGNAMemoryPtr(gnamem);
@@ -1611,7 +1634,7 @@ void GNAPlugin::Export(std::ostream &outStream) {
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GNAPlugin::GetPerformanceCounts() {
-    if (gnaFlags->performance_counting) {
+    if (gnaFlags->performance_counting && gnadevice) {
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
         gnadevice->getGnaPerfCounters(perfMap);
         return perfMap;
@@ -99,6 +99,10 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
             if (procType == supported_values.end()) {
                 if (value == GNA_CONFIG_VALUE(SW_FP32)) {
                     gnaFlags.sw_fp32 = true;
+                    gnaFlags.sw_exact_ref = false;
+                } else if (value == GNA_CONFIG_VALUE(SW_EXACT_REF)) {
+                    gnaFlags.sw_fp32 = false;
+                    gnaFlags.sw_exact_ref = true;
                 } else {
 #if GNA_LIB_VER == 1
                     auto is_gna2_mode = std::find(
@@ -112,6 +116,7 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                     THROW_GNA_EXCEPTION << "GNA device mode unsupported: " << value;
                 }
             } else {
+                gnaFlags.sw_exact_ref = false;
 #if GNA_LIB_VER == 1
                 gna_proc_type = static_cast<intel_gna_proc_t>(procType->second);
 #else
@@ -174,6 +179,8 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                     << ", should be greater than 0 and less than 100";
             }
             gnaFlags.pwlMaxErrorPercent = max_error;
+        } else if (key == GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR)) {
+            pwlDesignCacheDir = value;
         } else if (key == CONFIG_KEY(PERF_COUNT)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.performance_counting = true;
@@ -219,6 +226,9 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
         if (gnaFlags.sw_fp32 && gnaFlags.gna_lib_async_threads_num > 1) {
             THROW_GNA_EXCEPTION << "GNA plugin does not support async mode on GNA_SW_FP32!";
         }
+        if (gnaFlags.sw_exact_ref && gnaFlags.gna_lib_async_threads_num > 1) {
+            THROW_GNA_EXCEPTION << "GNA plugin does not support async mode on GNA_SW_EXACT_REF!";
+        }
     }
 
     if (inputScaleFactors.empty()) {
@@ -246,6 +256,8 @@ void Config::AdjustKeyMapValues() {
     std::string device_mode;
     if (gnaFlags.sw_fp32) {
         device_mode = GNA_CONFIG_VALUE(SW_FP32);
+    } else if (gnaFlags.sw_exact_ref) {
+        device_mode = GNA_CONFIG_VALUE(SW_EXACT_REF);
     } else {
         for (auto&& value : supported_values) {
 #if GNA_LIB_VER == 1
@@ -272,6 +284,7 @@ void Config::AdjustKeyMapValues() {
     keyConfigMap[GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN)] =
             gnaFlags.uniformPwlDesign ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT)] = std::to_string(gnaFlags.pwlMaxErrorPercent);
+    keyConfigMap[GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR)] = pwlDesignCacheDir;
     keyConfigMap[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
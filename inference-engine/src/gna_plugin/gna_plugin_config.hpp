@@ -33,6 +33,7 @@ struct Config {
         gnaPrecision = r.gnaPrecision;
         dumpXNNPath = r.dumpXNNPath;
         dumpXNNGeneration = r.dumpXNNGeneration;
+        pwlDesignCacheDir = r.pwlDesignCacheDir;
 #if GNA_LIB_VER == 1
         gna_proc_type = r.gna_proc_type;
 #else
@@ -55,6 +56,9 @@ struct Config {
     std::string dumpXNNPath;
     std::string dumpXNNGeneration;
 
+    // directory where optimized PWL designs are persisted, empty if they are not
+    std::string pwlDesignCacheDir;
+
 #if GNA_LIB_VER == 1
     intel_gna_proc_t gna_proc_type = static_cast<intel_gna_proc_t>(GNA_SOFTWARE & GNA_HARDWARE);
 #else
@@ -14,6 +14,7 @@
 #include <fstream>
 #include <limits>
 #include <iomanip>
+#include <cstdint>
 
 #include <legacy/graph_transformer.h>
 #include <blob_factory.hpp>
@@ -41,6 +42,7 @@
 #include "gna_graph_patterns.hpp"
 #include "gna_data_types.hpp"
 #include "gna_tensor_tools.hpp"
+#include "gna_itt.hpp"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -2348,15 +2350,80 @@ int PassManager::run(int index) {
     auto dumpNetworkAfterPass = [] (std::shared_ptr<Pass> ) {};
 #endif
 
+    OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "PassManager::run");
     for (auto && pass : passes) {
         if (settings.runBeforeCopy != pass->runBeforeCopyPass()) {
             continue;
         }
-        auto layers = CNNNetSortTopologically(network);
-        pass->attach(layers);
+        updateSortedLayers();
+        if (pass->isTopologyDriven()) {
+            auto lastRun = topologyAfterPass.find(pass->getName());
+            if (lastRun != topologyAfterPass.end() && lastRun->second == sortedTopology) {
+                gnalog() << "PASS: " << ++index << "/" << passes.size() << ":" << pass->getName() << " skipped, graph not changed\n";
+                continue;
+            }
+        }
+        pass->attach(sortedLayers);
         gnalog() << "PASS: " << ++index << "/" << passes.size() << ":" << pass->getName() << "\n";
-        pass->run();
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, openvino::itt::handle("GNAPass_" + pass->getName()));
+            pass->run();
+        }
+        if (pass->isTopologyDriven()) {
+            updateSortedLayers();
+            topologyAfterPass[pass->getName()] = sortedTopology;
+        }
         dumpNetworkAfterPass(pass);
     }
     return index;
 }
+
+/**
+ * @brief lists everything topological sort depends on: layers and data objects connecting them in visiting order,
+ * names of layers without inputs as traversal starts from them in name order, and network inputs and outputs
+ */
+static std::vector<size_t> topologySignature(const std::vector<CNNLayerPtr> & layers, const CNNNetwork & network) {
+    std::vector<size_t> signature;
+    signature.reserve(4 * layers.size());
+    auto id = [](const void * ptr) {
+        return static_cast<size_t>(reinterpret_cast<uintptr_t>(ptr));
+    };
+    for (auto && layer : layers) {
+        signature.push_back(id(layer.get()));
+        if (layer->insData.empty()) {
+            signature.push_back(std::hash<std::string>()(layer->name));
+        }
+        signature.push_back(layer->insData.size());
+        for (auto && input : layer->insData) {
+            signature.push_back(id(input.lock().get()));
+        }
+        signature.push_back(layer->outData.size());
+        for (auto && output : layer->outData) {
+            signature.push_back(id(output.get()));
+            auto & consumers = getInputTo(output);
+            signature.push_back(consumers.size());
+            for (auto && consumer : consumers) {
+                signature.push_back(id(consumer.second.get()));
+            }
+        }
+    }
+    for (auto && input : network.getInputsInfo()) {
+        signature.push_back(id(input.second->getInputData().get()));
+    }
+    for (auto && output : network.getOutputsInfo()) {
+        signature.push_back(id(output.second.get()));
+    }
+    return signature;
+}
+
+void PassManager::updateSortedLayers() {
+    // any pass changing connectivity has to touch links of layers already known, so walking previous order is enough
+    // to detect whether sorting is outdated, while the walk itself is much cheaper than sorting
+    if (!sortedLayers.empty() && topologySignature(sortedLayers, network) == sortedTopology) {
+        return;
+    }
+    OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "PassManager::sortTopologically");
+    sortedLayers = CNNNetSortTopologically(network);
+    sortedTopology = topologySignature(sortedLayers, network);
+    sortCount++;
+}
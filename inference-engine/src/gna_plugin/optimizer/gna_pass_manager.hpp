@@ -21,6 +21,11 @@ class Pass {
     virtual std::string getName() const = 0;
     virtual void run() = 0;
     virtual bool runBeforeCopyPass() { return false; }
+    /**
+     * @brief result of pass depends only on graph topology, so pass is not repeated on a graph
+     * that is left unchanged since its previous run
+     */
+    virtual bool isTopologyDriven() const { return false; }
 };
 /**
  * Passmanager interface available for individual passes, usually needed to store shared data between passes
@@ -183,7 +188,14 @@ DECL_PASS_BEFORE_COPY(UnrollTI);
 /**
 * @brief removed const layer before reshape layer
 */
-DECL_PASS_BEFORE_COPY(RemoveConst);
+class RemoveConstPass : public BasePass {
+ public:
+    using BasePass::BasePass;
+    void run() override;
+    bool runBeforeCopyPass() override { return true; }
+    bool isTopologyDriven() const override { return true; }
+    std::string getName() const override { return "RemoveConst"; }
+};
 
 /**
  * @brief remove concat layers with single input
@@ -231,6 +243,16 @@ class PassManager : public IPassManager, public std::enable_shared_from_this<Pas
     InferenceEngine::CNNNetwork network;
     std::vector<std::shared_ptr<Pass>> passes;
     std::map<std::string, int> intMap;
+    /**
+     * topological order shared by passes, it is rebuilt only when a pass changed graph connectivity
+     */
+    std::vector<InferenceEngine::CNNLayerPtr> sortedLayers;
+    std::vector<size_t> sortedTopology;
+    /// @brief topology observed after last run of topology driven passes
+    std::map<std::string, std::vector<size_t>> topologyAfterPass;
+    size_t sortCount = 0;
+
+    void updateSortedLayers();
 
 public:
     explicit PassManager(PassManagerSettings settings, InferenceEngine::CNNNetwork network) noexcept
@@ -253,6 +275,12 @@ public:
     InferenceEngine::CNNNetwork& getNetwork() override {
         return network;
     }
+    /**
+     * @brief number of times layers were sorted topologically, sorting is skipped while graph is unchanged
+     */
+    size_t getSortCount() const {
+        return sortCount;
+    }
     /**
      * @brief returns number of passes have been passed
      * @param index - start index start index of first pass - used only in logging right now
@@ -7,8 +7,10 @@
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -33,17 +35,14 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    InferenceEngine::parallel_for(num_filter_outputs, [&](uint32_t j) {
+        const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+            ptr_outputs[j * num_filters + i] = ptr_biases[i] + sdot(ptr_in, ptr_coef, num_filter_coefficients);
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -100,30 +99,21 @@ void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t
         float *ptr_inputs = reinterpret_cast<float *>(component->ptr_inputs);
         float *ptr_outputs = reinterpret_cast<float *>(component->ptr_outputs);
 
-        for (uint32_t i = 0; i < in_c; i++) {
-            int32_t m = 0;
-            if (sumPoolingOverRide) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * in_c + i];
-                    }
-                    ptr_outputs[m * in_c + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * in_c + i] > max) max = ptr_inputs[k * in_c + i];
-                    }
-                    ptr_outputs[m * in_c + i] = max;
-                    m++;
+        // all channels of an output row are pooled at once
+        const uint32_t num_rows_out = (num_rows_in + num_pool_step - 1) / num_pool_step;
+        InferenceEngine::parallel_for(num_rows_out, [&](uint32_t m) {
+            const uint32_t j = m * num_pool_step;
+            const uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+            float *ptr_out = ptr_outputs + m * in_c;
+            std::fill(ptr_out, ptr_out + in_c, sumPoolingOverRide ? 0.0f : -1e20f);
+            for (uint32_t k = j; k < num_end; k++) {
+                if (sumPoolingOverRide) {
+                    saxpy(1.0f, ptr_inputs + k * in_c, ptr_out, in_c);
+                } else {
+                    smax(ptr_inputs + k * in_c, ptr_out, in_c);
                 }
             }
-        }
+        });
     }
 }
 
@@ -136,21 +126,22 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
 }
 } // namespace
 
-float MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
+// pools all OC channels of the output pixel at once
+void MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
     const float* input, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
+    const unsigned oh, const unsigned ow, const unsigned OC,
     const uint32_t poolStrideH,
-    const uint32_t poolStrideW) {
-    float output = std::numeric_limits<float>::lowest();
+    const uint32_t poolStrideW,
+    float* output) {
+    std::fill(output, output + OC, std::numeric_limits<float>::lowest());
     const auto winStartH = oh * poolStrideH;
     const auto winStartW = ow * poolStrideW;
     for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
         for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
-            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, oc, IW, IC);
-            output = (std::max)(output, input[inputIndex]);
+            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, 0u, IW, IC);
+            smax(input + inputIndex, output, OC);
         }
     }
-    return output;
 }
 
 void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
@@ -169,18 +160,17 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
-    for (unsigned oc = 0; oc < OC; oc++) {
+    InferenceEngine::parallel_for(OH, [&](unsigned oh) {
         for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = MaxPool2D32SingleHWC(poolWinH, poolWinW,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    poolStrideH,
-                    poolStrideW);
-            }
+            const auto outputIndex = getQubeIndex(oh, ow, 0u, OW, OC);
+            MaxPool2D32SingleHWC(poolWinH, poolWinW,
+                ptr_inputs, IH, IW, IC,
+                oh, ow, OC,
+                poolStrideH,
+                poolStrideW,
+                ptr_outputs + outputIndex);
         }
-    }
+    });
 }
 
 #if GNA_LIB_VER == 2
@@ -209,21 +199,19 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
     const auto zPW = zeroPadding[1];
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
+        if (matchesPaddedArea(kh, oh, IH, zPH, cSH)) {
+            continue;
+        }
         for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+            if (matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                continue;
             }
+            // channels are the fastest changing index of both image and filter
+            const auto ih = (cSH * oh + kh) - zPH;
+            const auto iw = (cSW * ow + kw) - zPW;
+            const auto imageIndex = getQubeIndex(ih, iw, 0u, IW, IC);
+            const auto filterIndex = getQubeIndex(kh, kw, 0u, KW, KC);
+            output += sdot(image + imageIndex, filter + filterIndex, KC);
         }
     }
     output += bias;
@@ -258,21 +246,30 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
+    // padded input is checked once here, so the parallel loop below doesn't throw
+    const auto& convStride = component->op.conv2D.convStride;
+    const auto& zeroPadding = component->op.conv2D.zeroPadding;
+    if (OH > 0 && OW > 0 && kh > 0 && kw > 0 &&
+        (convStride[0] * (OH - 1) + kh > IH + 2 * zeroPadding[0] ||
+         convStride[1] * (OW - 1) + kw > IW + 2 * zeroPadding[1])) {
+        THROW_GNA_EXCEPTION << "Output doesn't fit into padded input!" << layer_name;
+    }
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    InferenceEngine::parallel_for(OC, [&](unsigned oc) {
+        const float* filter = ptr_filters + oc * kernelStride;
         for (unsigned ow = 0; ow < OW; ow++) {
             for (unsigned oh = 0; oh < OH; oh++) {
                 const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
+                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), filter, kh, kw, kc,
                     ptr_inputs, IH, IW, IC,
                     oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+                    convStride,
+                    zeroPadding);
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "floatmath_avx2.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+float sdot(const float *X, const float *Y, uint32_t N) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= N; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i + 8), _mm256_loadu_ps(Y + i + 8), acc1);
+    }
+    if (i + 8 <= N) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i), acc0);
+        i += 8;
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    sum4 = _mm_hadd_ps(sum4, sum4);
+    sum4 = _mm_hadd_ps(sum4, sum4);
+    float sum = _mm_cvtss_f32(sum4);
+
+    for (; i < N; i++) {
+        sum += X[i] * Y[i];
+    }
+    return sum;
+}
+
+void saxpy(float alpha, const float *X, float *Y, uint32_t N) {
+    const __m256 a = _mm256_set1_ps(alpha);
+    uint32_t i = 0;
+    for (; i + 8 <= N; i += 8) {
+        _mm256_storeu_ps(Y + i, _mm256_fmadd_ps(a, _mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i)));
+    }
+    for (; i < N; i++) {
+        Y[i] += alpha * X[i];
+    }
+}
+
+void smax(const float *X, float *Y, uint32_t N) {
+    uint32_t i = 0;
+    for (; i + 8 <= N; i += 8) {
+        _mm256_storeu_ps(Y + i, _mm256_max_ps(_mm256_loadu_ps(Y + i), _mm256_loadu_ps(X + i)));
+    }
+    for (; i < N; i++) {
+        Y[i] = (X[i] > Y[i]) ? X[i] : Y[i];
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
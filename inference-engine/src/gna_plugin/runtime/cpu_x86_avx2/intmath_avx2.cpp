@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+#include "intmath_avx2.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+namespace {
+
+// adds 32 bit lanes of v to 64 bit lanes of acc
+__m256i add_widened(__m256i acc, __m256i v) {
+    acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+}
+
+int64_t hsum64(__m256i v) {
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+}  // namespace
+
+int64_t idot16(const int16_t *W, const int16_t *X, uint32_t N) {
+    // madd sums pairs of products in 32 bits, it wraps only when both products are -32768 * -32768
+    // and no other pair gives INT32_MIN, so such lanes are counted and 2^32 is added for each of them
+    const __m256i int32_min = _mm256_set1_epi32(INT32_MIN);
+    __m256i acc = _mm256_setzero_si256();
+    __m256i wrapped = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 16 <= N; i += 16) {
+        const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(W + i));
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(X + i));
+        const __m256i p = _mm256_madd_epi16(w, x);
+        wrapped = _mm256_sub_epi32(wrapped, _mm256_cmpeq_epi32(p, int32_min));
+        acc = add_widened(acc, p);
+    }
+    int64_t sum = hsum64(acc) + hsum64(add_widened(_mm256_setzero_si256(), wrapped)) * (INT64_C(1) << 32);
+
+    for (; i < N; i++) {
+        sum += static_cast<int32_t>(W[i]) * X[i];
+    }
+    return sum;
+}
+
+int64_t idot8(const int8_t *W, const int16_t *X, uint32_t N) {
+    // a pair of products doesn't exceed 2^23 in magnitude, so blocks of 128 pairs are summed in 32 bits
+    constexpr uint32_t block_size = 16 * 128;
+    const uint32_t N16 = N - N % 16;
+    __m256i acc = _mm256_setzero_si256();
+    uint32_t i = 0;
+    while (i < N16) {
+        const uint32_t block_end = std::min(N16, i + block_size);
+        __m256i block = _mm256_setzero_si256();
+        for (; i < block_end; i += 16) {
+            const __m256i w = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(W + i)));
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(X + i));
+            block = _mm256_add_epi32(block, _mm256_madd_epi16(w, x));
+        }
+        acc = add_widened(acc, block);
+    }
+    int64_t sum = hsum64(acc);
+
+    for (; i < N; i++) {
+        sum += static_cast<int32_t>(W[i]) * X[i];
+    }
+    return sum;
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+// exact sum of W[i] * X[i]
+int64_t idot16(const int16_t *W, const int16_t *X, uint32_t N);
+
+// exact sum of W[i] * X[i]
+int64_t idot8(const int8_t *W, const int16_t *X, uint32_t N);
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
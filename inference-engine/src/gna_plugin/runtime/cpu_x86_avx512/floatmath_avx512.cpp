@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "floatmath_avx512.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+float sdot(const float *X, const float *Y, uint32_t N) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 32 <= N; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(X + i), _mm512_loadu_ps(Y + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(X + i + 16), _mm512_loadu_ps(Y + i + 16), acc1);
+    }
+    if (i + 16 <= N) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(X + i), _mm512_loadu_ps(Y + i), acc0);
+        i += 16;
+    }
+    if (i < N) {
+        const __mmask16 tail = static_cast<__mmask16>((1u << (N - i)) - 1);
+        acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, X + i), _mm512_maskz_loadu_ps(tail, Y + i), acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+void saxpy(float alpha, const float *X, float *Y, uint32_t N) {
+    const __m512 a = _mm512_set1_ps(alpha);
+    uint32_t i = 0;
+    for (; i + 16 <= N; i += 16) {
+        _mm512_storeu_ps(Y + i, _mm512_fmadd_ps(a, _mm512_loadu_ps(X + i), _mm512_loadu_ps(Y + i)));
+    }
+    if (i < N) {
+        const __mmask16 tail = static_cast<__mmask16>((1u << (N - i)) - 1);
+        const __m512 y = _mm512_maskz_loadu_ps(tail, Y + i);
+        _mm512_mask_storeu_ps(Y + i, tail, _mm512_fmadd_ps(a, _mm512_maskz_loadu_ps(tail, X + i), y));
+    }
+}
+
+void smax(const float *X, float *Y, uint32_t N) {
+    uint32_t i = 0;
+    for (; i + 16 <= N; i += 16) {
+        _mm512_storeu_ps(Y + i, _mm512_max_ps(_mm512_loadu_ps(Y + i), _mm512_loadu_ps(X + i)));
+    }
+    if (i < N) {
+        const __mmask16 tail = static_cast<__mmask16>((1u << (N - i)) - 1);
+        const __m512 y = _mm512_maskz_loadu_ps(tail, Y + i);
+        _mm512_mask_storeu_ps(Y + i, tail, _mm512_max_ps(y, _mm512_maskz_loadu_ps(tail, X + i)));
+    }
+}
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
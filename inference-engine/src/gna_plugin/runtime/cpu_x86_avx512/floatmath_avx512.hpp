@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+// sum of X[i] * Y[i]
+float sdot(const float *X, const float *Y, uint32_t N);
+
+// Y += alpha * X
+void saxpy(float alpha, const float *X, float *Y, uint32_t N);
+
+// Y = max(Y, X) elementwise
+void smax(const float *X, float *Y, uint32_t N);
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -1,13 +1,81 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, vectorized and multithreaded across output rows
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <exception>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include "floatmath.h"
+#include "isa_dispatch.hpp"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512F
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace {
+
+float sdot_ref(const float *X, const float *Y, uint32_t N) {
+    float sum = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        sum += X[i] * Y[i];
+    }
+    return sum;
+}
+
+void saxpy_ref(float alpha, const float *X, float *Y, uint32_t N) {
+    for (uint32_t i = 0; i < N; i++) {
+        Y[i] += alpha * X[i];
+    }
+}
+
+void smax_ref(const float *X, float *Y, uint32_t N) {
+    for (uint32_t i = 0; i < N; i++) {
+        Y[i] = (X[i] > Y[i]) ? X[i] : Y[i];
+    }
+}
+
+struct FloatKernels {
+    float (*sdot)(const float *X, const float *Y, uint32_t N);
+    void (*saxpy)(float alpha, const float *X, float *Y, uint32_t N);
+    void (*smax)(const float *X, float *Y, uint32_t N);
+};
+
+const FloatKernels &floatKernels() {
+    using namespace GNAPluginNS::runtime;
+    static const FloatKernels kernels = selectKernels<FloatKernels>({
+#ifdef HAVE_AVX512F
+        {Isa::AVX512F, {avx512::sdot, avx512::saxpy, avx512::smax}},
+#endif
+#ifdef HAVE_AVX2
+        {Isa::AVX2, {avx2::sdot, avx2::saxpy, avx2::smax}},
+#endif
+        {Isa::Scalar, {sdot_ref, saxpy_ref, smax_ref}}});
+    return kernels;
+}
+
+// B is KxN matrix with leading dimension ldb, returns NxK matrix so that columns of B are contiguous.
+// The matrix is valid until the next call on the same thread, so layers executed one after another
+// reuse the same buffer instead of allocating it on every call
+const float *transpose(const float *B, int K, int N, int ldb) {
+    thread_local std::vector<float> Bt;
+    Bt.resize(static_cast<size_t>(N) * K);
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            Bt[static_cast<size_t>(j) * K + k] = B[k * ldb + j];
+        }
+    }
+    return Bt.data();
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,26 +95,19 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
+        const float *Bt = transpose(B, K, N, ldb);
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+                C[i * ldc + j] = sum + sdot(A + i * lda, Bt + j * K, K);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int j = 0; j < N; j++) {
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * sdot(A + i * lda, B + j * ldb, K);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,28 +166,21 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
+        const float *Bt = transpose(B, K, N, ldb);
+        InferenceEngine::parallel_for(L, [&](int l) {
+            const int row = OutputList[l];
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+                C[l * ldc + j] = sum + sdot(A + row * lda, Bt + j * K, K);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int l = 0; l < L; l++) {
+                const int col = OutputList[l];
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * sdot(A + i * lda, B + col * ldb, K);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
@@ -155,18 +209,23 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    InferenceEngine::parallel_for(num_rows, [&](uint32_t i) {
+        const float *X_row = X + i * num_columns;
+        C[i] = B[i] + sdot(A1, X_row, K1) + sdot(A2, X_row + K1, K2);
+    });
+}
+
+float sdot(const float *X, const float *Y, const uint32_t N) {
+    return floatKernels().sdot(X, Y, N);
+}
+
+void saxpy(const float alpha, const float *X, float *Y, const uint32_t N) {
+    floatKernels().saxpy(alpha, X, Y, N);
+}
+
+void smax(const float *X, float *Y, const uint32_t N) {
+    floatKernels().smax(X, Y, N);
 }
 
 #ifdef __cplusplus
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 
@@ -59,6 +60,11 @@ void sgemv_split(const uint32_t N,
                  const float *B,
                  float *C);
 
+// vectorized helpers, the widest instruction set supported by the host is used
+float sdot(const float *X, const float *Y, const uint32_t N);                // returns sum of X[i] * Y[i]
+void saxpy(const float alpha, const float *X, float *Y, const uint32_t N);  // Y += alpha * X
+void smax(const float *X, float *Y, const uint32_t N);                      // Y = max(Y, X)
+
 #ifdef __cplusplus
 }
 #endif
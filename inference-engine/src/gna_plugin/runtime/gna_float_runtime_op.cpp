@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+
+#include <ie_parallel.hpp>
+
 #include "gna_float_runtime.hpp"
 #include "pwl.h"
 #include "cnn.h"
@@ -74,18 +78,12 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    for (uint32_t i = 0; i < m; i++) {
-        for (uint32_t j = 0; j < n; j++) {
-            C[i * ldc + j] = bias[i];
-        }
-    }
-    std::vector<float> Arow(n);
-    for (uint32_t i = 0; i < m; i++) {
+    InferenceEngine::parallel_for(m, [&](int i) {
         float *Brow = B + i * n;
         float *Crow = C + i * ldc;
-        std::fill(std::begin(Arow), std::end(Arow), A[i]);
-        cblas_ssbmv1(CblasRowMajor, CblasLower, n, 0, 1.0, Arow.data(), 1, Brow, 1, 1.0, Crow, 1);
-    }
+        std::fill(Crow, Crow + n, bias[i]);
+        saxpy(A[i], Brow, Crow, n);
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -162,11 +160,11 @@ void FP::ApplyTranspose(intel_dnn_component_t *component) {
     // B = Transpose(A) where A is mxn and B is nxm
     auto A = reinterpret_cast<float *>(component->ptr_inputs);
     auto B = reinterpret_cast<float *>(component->ptr_outputs);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
+    InferenceEngine::parallel_for(n, [&](int col) {
+        for (int row = 0; row < m; row++) {
             B[col * ldb + row] = A[row * lda + col];
         }
-    }
+    });
 }
 
 void FP::ApplyCopy(intel_dnn_component_t *component) {
@@ -185,9 +183,7 @@ void FP::ApplyCopy(intel_dnn_component_t *component) {
     }
     auto A = reinterpret_cast<float *>(src);
     auto B = reinterpret_cast<float *>(dst);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
-            B[row * ldb + col] = A[row * lda + col];
-        }
-    }
+    InferenceEngine::parallel_for(m, [&](int32_t row) {
+        std::copy(A + row * lda, A + row * lda + n, B + row * ldb);
+    });
 }
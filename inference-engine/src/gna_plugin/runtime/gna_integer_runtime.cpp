@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gna_plugin_log.hpp>
+#include <cstdint>
+#include <backend/dnn_types.h>
+#include "gna_integer_runtime.hpp"
+
+using namespace GNAPluginNS;
+using namespace GNAPluginNS::runtime;
+
+
+void Integer::infer() {
+    if (!dnn) {
+        THROW_GNA_EXCEPTION << "[GNA INTEGER RUNTIME] not initialized";
+    }
+
+    for (uint32_t i = 0; i < dnn->component.size(); i++) {
+        intel_dnn_component_t *comp = &dnn->component[i];
+        uint32_t *ptr_active_outputs = nullptr;
+        uint32_t num_active_outputs = (comp->orientation_out == kDnnInterleavedOrientation)
+                                      ? comp->num_rows_out : comp->num_columns_out;
+
+        if (i == dnn->component.size() - 1) {  // active list applies to last component
+            ptr_active_outputs = dnn->ptr_active_outputs();
+            num_active_outputs = dnn->num_active_outputs();
+        } else if (i == dnn->component.size() - 2) {  // also applies to last two components when last is PWL
+            if ((dnn->component[i].operation == kDnnAffineOp) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
+                ptr_active_outputs = dnn->ptr_active_outputs();
+                num_active_outputs = dnn->num_active_outputs();
+            }
+        }
+
+        switch (comp->operation) {
+            case kDnnAffineOp : {
+                ApplyAffineTransform(comp, ptr_active_outputs, num_active_outputs);
+                break;
+            }
+            case kDnnDiagonalOp: {
+                ApplyDiagonalTransform(comp);
+                break;
+            }
+            case kDnnRecurrentOp: {
+                if ((i < dnn->component.size() - 1) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
+                    intel_dnn_component_t *comp_pwl = &dnn->component[i + 1];
+                    for (uint32_t j = 0; j < comp->num_rows_in; j++) {
+                        void *ptr_feedbacks =
+                            reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(comp->op.recurrent.ptr_feedbacks)
+                                + j * comp_pwl->num_columns_out * comp_pwl->num_bytes_per_output);
+                        ApplyRecurrentTransform(comp, j, ptr_feedbacks, comp_pwl->num_bytes_per_output);
+                        ApplyPiecewiseLinearTransform(comp_pwl, num_active_outputs, j);
+                    }
+                    i++;  // skip next component
+                } else {
+                    THROW_GNA_EXCEPTION << "Missing PiecewiseLinear component after Recurrent component in Propagate!";
+                }
+                break;
+            }
+            case kDnnConvolutional1dOp: {
+                ApplyConvolutional1DTransform(comp);
+                break;
+            }
+            case kDnnPiecewiselinearOp: {
+                ApplyPiecewiseLinearTransform(comp, num_active_outputs);
+                break;
+            }
+            case kDnnMaxPoolOp: {
+                ApplyMaxPoolTransform(comp);
+                break;
+            }
+            case kDnnInterleaveOp: {
+                ApplyTranspose(comp);
+                break;
+            }
+            case kDnnDeinterleaveOp: {
+                ApplyTranspose(comp);
+                break;
+            }
+            case kDnnCopyOp: {
+                ApplyCopy(comp);
+                break;
+            }
+            default:
+                THROW_GNA_EXCEPTION << "[GNA INTEGER RUNTIME] Unsupported operation " << intel_dnn_operation_name[comp->operation];
+        }
+    }
+}
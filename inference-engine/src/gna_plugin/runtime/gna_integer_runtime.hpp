@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+#include <backend/am_intel_dnn.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+/**
+ * @brief integer runtime for gna-plugin, executes quantized gna-primitives on CPU bit exactly with GNA accumulation
+ * and saturation rules, so quantized models are validated without GNA library and device
+ */
+class Integer {
+    std::shared_ptr<backend::AMIntelDNN> dnn;
+
+ public:
+    Integer(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
+    }
+    virtual void infer();
+
+    /**
+     * atomic operations for integer inference
+     */
+    static void ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list, uint32_t listsize);
+    static void ApplyDiagonalTransform(intel_dnn_component_t *component);
+    static void ApplyRecurrentTransform(intel_dnn_component_t *component,
+                                        uint32_t row,
+                                        void *ptr_feedbacks,
+                                        uint32_t num_bytes_per_feedback);
+    static void ApplyConvolutional1DTransform(intel_dnn_component_t *component);
+    static void ApplyPiecewiseLinearTransform(intel_dnn_component_t *component, uint32_t listsize);
+    static void ApplyPiecewiseLinearTransform(intel_dnn_component_t *component, uint32_t listsize, uint32_t num_row);
+    static void ApplyMaxPoolTransform(intel_dnn_component_t *component);
+    static void ApplyTranspose(intel_dnn_component_t *component);
+    static void ApplyCopy(intel_dnn_component_t *component);
+};
+
+}  // namespace runtime
+
+}  // namespace GNAPluginNS
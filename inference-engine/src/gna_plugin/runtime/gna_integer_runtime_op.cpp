@@ -0,0 +1,363 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include "gna_integer_runtime.hpp"
+#include "backend/gna_types.h"
+#include "pwl.h"
+#include "cnn.h"
+#include "intmath.h"
+
+using namespace GNAPluginNS;
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+void checkDataWidth(uint32_t num_bytes, std::initializer_list<uint32_t> supported, const char *what) {
+    for (auto width : supported) {
+        if (num_bytes == width) {
+            return;
+        }
+    }
+    THROW_GNA_EXCEPTION << "Bad " << what << " width: " << num_bytes;
+}
+
+int64_t load(const void *ptr, uint32_t num_bytes, size_t index) {
+    switch (num_bytes) {
+        case 1: return reinterpret_cast<const int8_t *>(ptr)[index];
+        case 2: return reinterpret_cast<const int16_t *>(ptr)[index];
+        default: return reinterpret_cast<const int32_t *>(ptr)[index];
+    }
+}
+
+void store(void *ptr, uint32_t num_bytes, size_t index, int64_t value, uint32_t &num_saturate) {
+    switch (num_bytes) {
+        case 1: reinterpret_cast<int8_t *>(ptr)[index] = saturate<int8_t>(value, num_saturate); break;
+        case 2: reinterpret_cast<int16_t *>(ptr)[index] = saturate<int16_t>(value, num_saturate); break;
+        default: reinterpret_cast<int32_t *>(ptr)[index] = saturate<int32_t>(value, num_saturate); break;
+    }
+}
+
+// returns KxN matrix with leading dimension ld as NxK int16 matrix, so that its columns are contiguous
+std::vector<int16_t> columns(const void *ptr, uint32_t num_bytes, uint32_t K, uint32_t N, uint32_t ld) {
+    std::vector<int16_t> result(static_cast<size_t>(N) * K);
+    for (uint32_t k = 0; k < K; k++) {
+        for (uint32_t j = 0; j < N; j++) {
+            result[static_cast<size_t>(j) * K + k] = static_cast<int16_t>(load(ptr, num_bytes, static_cast<size_t>(k) * ld + j));
+        }
+    }
+    return result;
+}
+
+/**
+ * int8 or int16 weights with biases they are paired with, int8 weights may use compound biases
+ * which carry per row multipliers of weights
+ */
+struct Weights {
+    const void *ptr_weights;
+    uint32_t num_bytes_per_weight;
+    const void *ptr_biases;
+    uint32_t num_bytes_per_bias;
+
+    Weights(const void *ptr_weights, uint32_t num_bytes_per_weight, const void *ptr_biases, uint32_t num_bytes_per_bias)
+        : ptr_weights(ptr_weights), num_bytes_per_weight(num_bytes_per_weight),
+          ptr_biases(ptr_biases), num_bytes_per_bias(num_bytes_per_bias) {
+        checkDataWidth(num_bytes_per_weight, {1, 2}, "weight");
+        checkDataWidth(num_bytes_per_bias, {1, 2, 4, sizeof(gna_compound_bias_t)}, "bias");
+    }
+
+    bool compound() const {
+        return num_bytes_per_bias == sizeof(gna_compound_bias_t);
+    }
+
+    int64_t bias(uint32_t row) const {
+        return compound() ? reinterpret_cast<const gna_compound_bias_t *>(ptr_biases)[row].bias
+                          : load(ptr_biases, num_bytes_per_bias, row);
+    }
+
+    int64_t multiplier(uint32_t row) const {
+        return compound() ? reinterpret_cast<const gna_compound_bias_t *>(ptr_biases)[row].multiplier : 1;
+    }
+
+    int64_t weight(size_t index) const {
+        return load(ptr_weights, num_bytes_per_weight, index);
+    }
+
+    // bias[row] + multiplier[row] * sum of W[row, i] * X[i]
+    int64_t affine(uint32_t row, uint32_t num_columns, const int16_t *X) const {
+        const size_t offset = static_cast<size_t>(row) * num_columns;
+        const int64_t sum = (num_bytes_per_weight == 1)
+            ? idot8(reinterpret_cast<const int8_t *>(ptr_weights) + offset, X, num_columns)
+            : idot16(reinterpret_cast<const int16_t *>(ptr_weights) + offset, X, num_columns);
+        return bias(row) + multiplier(row) * sum;
+    }
+};
+
+void logSaturations(const std::atomic<uint32_t> &num_saturate, const intel_dnn_component_t *component) {
+    if (num_saturate > 0) {
+        gnalog() << "Warning: " << num_saturate << " saturations in "
+                 << (component->original_layer_name ? component->original_layer_name : "") << "\n";
+    }
+}
+
+void pwlApply(intel_dnn_component_t *component,
+              uint32_t num_row_start,
+              uint32_t num_row_end,
+              uint32_t num_col_start,
+              uint32_t num_col_end) {
+    checkDataWidth(component->num_bytes_per_input, {4}, "input");
+    checkDataWidth(component->num_bytes_per_output, {1, 2}, "output");
+    const uint32_t num_segments = component->op.pwl.num_segments;
+    if (num_segments == 0) {
+        return;
+    }
+    const gna_pwl_segment_t *segments = component->op.pwl.ptr_segments;
+    const auto inputs = reinterpret_cast<const int32_t *>(component->ptr_inputs);
+    const uint32_t num_columns = component->num_columns_in;
+    const uint32_t num_bytes_per_output = component->num_bytes_per_output;
+
+    std::atomic<uint32_t> num_saturate{0};
+    InferenceEngine::parallel_for(num_row_end - num_row_start + 1, [&](uint32_t r) {
+        const uint32_t i = num_row_start + r;
+        uint32_t row_saturate = 0;
+        for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            const size_t index = static_cast<size_t>(i) * num_columns + j;
+            const int32_t input = inputs[index];
+            int64_t output = segments[0].yBase;
+            if (input > static_cast<int32_t>(segments[0].xBase & XBASEMASK)) {
+                // the last segment which starts not after input
+                uint32_t k_lower = 0;
+                uint32_t k_upper = num_segments;
+                while (k_upper > k_lower + 1) {
+                    const uint32_t k = (k_lower + k_upper) / 2;
+                    if (static_cast<int32_t>(segments[k].xBase & XBASEMASK) > input) {
+                        k_upper = k;
+                    } else {
+                        k_lower = k;
+                    }
+                }
+                const gna_pwl_segment_t &segment = segments[k_lower];
+                const int64_t xbase = static_cast<int32_t>(segment.xBase & XBASEMASK);
+                const uint32_t slope_shift = ((segment.xBase & ~XBASEMASK) + 1) * 8;
+                output = (((input - xbase) * segment.slope) >> slope_shift) + segment.yBase;
+            }
+            store(component->ptr_outputs, num_bytes_per_output, index, output, row_saturate);
+        }
+        if (row_saturate > 0) {
+            num_saturate += row_saturate;
+        }
+    });
+    logSaturations(num_saturate, component);
+}
+
+template <typename T>
+void transpose(const T *A, T *B, uint32_t m, uint32_t n, uint32_t lda, uint32_t ldb) {
+    InferenceEngine::parallel_for(n, [&](uint32_t col) {
+        for (uint32_t row = 0; row < m; row++) {
+            B[col * ldb + row] = A[row * lda + col];
+        }
+    });
+}
+
+}  // namespace
+
+void Integer::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list, uint32_t listsize) {
+    checkDataWidth(component->num_bytes_per_input, {1, 2}, "input");
+    checkDataWidth(component->num_bytes_per_output, {1, 2, 4}, "output");
+
+    auto transform = &component->op.affine;
+    const Weights weights(transform->ptr_weights, transform->num_bytes_per_weight,
+                          transform->ptr_biases, transform->num_bytes_per_bias);
+    const uint32_t m = component->num_rows_out;
+    const uint32_t n = component->num_columns_in;
+    const uint32_t k = component->num_rows_in;
+    const uint32_t ldc = component->num_columns_out;
+    const uint32_t num_bytes_per_output = component->num_bytes_per_output;
+
+    const auto B = columns(component->ptr_inputs, component->num_bytes_per_input, k, n, n);
+    std::atomic<uint32_t> num_saturate{0};
+    InferenceEngine::parallel_for(list == nullptr ? m : listsize, [&](uint32_t l) {
+        const uint32_t i = list == nullptr ? l : list[l];
+        uint32_t row_saturate = 0;
+        for (uint32_t j = 0; j < n; j++) {
+            store(component->ptr_outputs, num_bytes_per_output, static_cast<size_t>(l) * ldc + j,
+                  weights.affine(i, k, B.data() + static_cast<size_t>(j) * k), row_saturate);
+        }
+        if (row_saturate > 0) {
+            num_saturate += row_saturate;
+        }
+    });
+    logSaturations(num_saturate, component);
+}
+
+void Integer::ApplyDiagonalTransform(intel_dnn_component_t *component) {
+    checkDataWidth(component->num_bytes_per_input, {1, 2}, "input");
+    checkDataWidth(component->num_bytes_per_output, {1, 2, 4}, "output");
+
+    auto transform = &component->op.affine;
+    const Weights weights(transform->ptr_weights, transform->num_bytes_per_weight,
+                          transform->ptr_biases, transform->num_bytes_per_bias);
+    const uint32_t m = component->num_rows_out;
+    const uint32_t n = component->num_columns_in;
+    const uint32_t ldc = component->num_columns_out;
+
+    std::atomic<uint32_t> num_saturate{0};
+    InferenceEngine::parallel_for(m, [&](uint32_t i) {
+        const int64_t weight = weights.weight(i) * weights.multiplier(i);
+        const int64_t bias = weights.bias(i);
+        uint32_t row_saturate = 0;
+        for (uint32_t j = 0; j < n; j++) {
+            const int64_t input = load(component->ptr_inputs, component->num_bytes_per_input, static_cast<size_t>(i) * n + j);
+            store(component->ptr_outputs, component->num_bytes_per_output, static_cast<size_t>(i) * ldc + j,
+                  bias + weight * input, row_saturate);
+        }
+        if (row_saturate > 0) {
+            num_saturate += row_saturate;
+        }
+    });
+    logSaturations(num_saturate, component);
+}
+
+void Integer::ApplyRecurrentTransform(intel_dnn_component_t *component,
+                                      uint32_t row,
+                                      void *ptr_feedbacks,
+                                      uint32_t num_bytes_per_feedback) {
+    checkDataWidth(component->num_bytes_per_input, {1, 2}, "input");
+    checkDataWidth(num_bytes_per_feedback, {1, 2}, "feedback");
+    checkDataWidth(component->num_bytes_per_output, {1, 2, 4}, "output");
+    if (component->op.recurrent.ptr_feedbacks == nullptr) {
+        THROW_GNA_EXCEPTION << "nullptr feedback pointer";
+    }
+
+    intel_recurrent_t *transform = &component->op.recurrent;
+    const Weights weights(transform->ptr_weights, transform->num_bytes_per_weight,
+                          transform->ptr_biases, transform->num_bytes_per_bias);
+    const uint32_t k1 = component->num_columns_in;
+    const uint32_t k2 = component->num_columns_out;
+
+    // input row followed by feedbacks are multiplied by the rows of weights at once
+    std::vector<int16_t> X(k1 + k2);
+    for (uint32_t c = 0; c < k1; c++) {
+        X[c] = static_cast<int16_t>(load(component->ptr_inputs, component->num_bytes_per_input,
+                                         static_cast<size_t>(row) * k1 + c));
+    }
+    for (uint32_t c = 0; c < k2; c++) {
+        X[k1 + c] = static_cast<int16_t>(load(ptr_feedbacks, num_bytes_per_feedback, c));
+    }
+
+    std::atomic<uint32_t> num_saturate{0};
+    InferenceEngine::parallel_for(k2, [&](uint32_t i) {
+        uint32_t row_saturate = 0;
+        store(component->ptr_outputs, component->num_bytes_per_output, static_cast<size_t>(row) * k2 + i,
+              weights.affine(i, k1 + k2, X.data()), row_saturate);
+        if (row_saturate > 0) {
+            num_saturate += row_saturate;
+        }
+    });
+    logSaturations(num_saturate, component);
+}
+
+void Integer::ApplyConvolutional1DTransform(intel_dnn_component_t *component) {
+    checkDataWidth(component->num_bytes_per_input, {1, 2}, "input");
+    checkDataWidth(component->num_bytes_per_output, {1, 2, 4}, "output");
+
+    auto transform = &component->op.conv1D;
+    const Weights filters(transform->ptr_filters, transform->num_bytes_per_weight,
+                          transform->ptr_biases, transform->num_bytes_per_bias);
+    const uint32_t num_filter_outputs = transform->num_feature_map_rows - transform->num_filter_rows + 1;
+    const uint32_t num_inputs_band_stride = transform->num_feature_maps * transform->num_feature_map_columns;
+    const uint32_t num_filter_coefficients = transform->num_filter_coefficients;
+    const uint32_t num_filters = transform->num_filters;
+
+    if (component->num_rows_in != 1 || component->num_rows_out != 1) {
+        THROW_GNA_EXCEPTION << "Bad number of rows in convolution of " << component->original_layer_name;
+    }
+    if (component->num_columns_out < num_filter_outputs * num_filters) {
+        THROW_GNA_EXCEPTION << "Bad num_columns_out in convolution of " << component->original_layer_name;
+    }
+
+    const auto inputs = columns(component->ptr_inputs, component->num_bytes_per_input, 1,
+                                component->num_columns_in, component->num_columns_in);
+    std::atomic<uint32_t> num_saturate{0};
+    InferenceEngine::parallel_for(num_filter_outputs, [&](uint32_t j) {
+        const int16_t *ptr_in = inputs.data() + static_cast<size_t>(j) * num_inputs_band_stride;
+        uint32_t row_saturate = 0;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            store(component->ptr_outputs, component->num_bytes_per_output, static_cast<size_t>(j) * num_filters + i,
+                  filters.affine(i, num_filter_coefficients, ptr_in), row_saturate);
+        }
+        if (row_saturate > 0) {
+            num_saturate += row_saturate;
+        }
+    });
+    logSaturations(num_saturate, component);
+}
+
+void Integer::ApplyPiecewiseLinearTransform(intel_dnn_component_t *component, uint32_t listsize) {
+    if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
+        pwlApply(component, 0, listsize - 1, 0, component->num_columns_in - 1);
+    } else {
+        pwlApply(component, 0, component->num_rows_in - 1, 0, component->num_columns_in - 1);
+    }
+}
+
+void Integer::ApplyPiecewiseLinearTransform(intel_dnn_component_t *component, uint32_t listsize, uint32_t num_row) {
+    pwlApply(component, num_row, num_row, 0, listsize - 1);
+}
+
+void Integer::ApplyMaxPoolTransform(intel_dnn_component_t *component) {
+    checkDataWidth(component->num_bytes_per_input, {4}, "input");
+    if (component->op.maxpool.poolingWindowXY[1] > 1 || component->op.maxpool.poolingStrideXY[1] > 1) {
+        THROW_GNA_EXCEPTION << "[GNA INTEGER RUNTIME] 2D pooling is not supported";
+    }
+    CNNMaxPool(component, kDnnInt);
+}
+
+void Integer::ApplyTranspose(intel_dnn_component_t *component) {
+    const uint32_t m = component->num_rows_in;
+    const uint32_t n = component->num_columns_in;
+    const uint32_t lda = component->num_columns_in;
+    const uint32_t ldb = component->num_columns_out;
+    // B = Transpose(A) where A is mxn and B is nxm
+    switch (component->num_bytes_per_input) {
+        case 1:
+            transpose(reinterpret_cast<int8_t *>(component->ptr_inputs), reinterpret_cast<int8_t *>(component->ptr_outputs),
+                      m, n, lda, ldb);
+            break;
+        case 2:
+            transpose(reinterpret_cast<int16_t *>(component->ptr_inputs), reinterpret_cast<int16_t *>(component->ptr_outputs),
+                      m, n, lda, ldb);
+            break;
+        case 4:
+            transpose(reinterpret_cast<int32_t *>(component->ptr_inputs), reinterpret_cast<int32_t *>(component->ptr_outputs),
+                      m, n, lda, ldb);
+            break;
+        default:
+            THROW_GNA_EXCEPTION << "Bad data width: " << component->num_bytes_per_input;
+    }
+}
+
+void Integer::ApplyCopy(intel_dnn_component_t *component) {
+    checkDataWidth(component->num_bytes_per_input, {1, 2, 4}, "input");
+
+    auto src = reinterpret_cast<uint8_t *>(component->ptr_inputs);
+    auto dst = reinterpret_cast<uint8_t *>(component->ptr_outputs);
+    const uint32_t num_bytes = component->num_bytes_per_input;
+    const uint32_t m = component->op.copy.num_copy_rows;
+    const uint32_t n = component->op.copy.num_copy_columns;
+    const uint32_t lda = component->num_columns_in;
+    const uint32_t ldb = component->num_columns_out;
+    if (m > component->num_rows_in) {
+        THROW_GNA_EXCEPTION << "Error:  attempt to copy more columns than matrix has";
+    }
+    InferenceEngine::parallel_for(m, [&](uint32_t row) {
+        std::memcpy(dst + static_cast<size_t>(row) * ldb * num_bytes, src + static_cast<size_t>(row) * lda * num_bytes,
+                    static_cast<size_t>(n) * num_bytes);
+    });
+}
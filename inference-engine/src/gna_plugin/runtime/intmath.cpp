@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// intmath.cpp : integer math routines of the bit exact runtime
+//
+
+#include <cstdint>
+#include <exception>
+
+#include "intmath.h"
+#include "isa_dispatch.hpp"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/intmath_avx2.hpp"
+#endif
+
+namespace {
+
+int64_t idot16_ref(const int16_t *W, const int16_t *X, uint32_t N) {
+    int64_t sum = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        sum += static_cast<int32_t>(W[i]) * X[i];
+    }
+    return sum;
+}
+
+int64_t idot8_ref(const int8_t *W, const int16_t *X, uint32_t N) {
+    int64_t sum = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        sum += static_cast<int32_t>(W[i]) * X[i];
+    }
+    return sum;
+}
+
+struct IntKernels {
+    int64_t (*idot16)(const int16_t *W, const int16_t *X, uint32_t N);
+    int64_t (*idot8)(const int8_t *W, const int16_t *X, uint32_t N);
+};
+
+const IntKernels &intKernels() {
+    using namespace GNAPluginNS::runtime;
+    static const IntKernels kernels = selectKernels<IntKernels>({
+#ifdef HAVE_AVX2
+        {Isa::AVX2, {avx2::idot16, avx2::idot8}},
+#endif
+        {Isa::Scalar, {idot16_ref, idot8_ref}}});
+    return kernels;
+}
+
+}  // namespace
+
+namespace GNAPluginNS {
+namespace runtime {
+
+int64_t idot16(const int16_t *W, const int16_t *X, uint32_t N) {
+    return intKernels().idot16(W, X, N);
+}
+
+int64_t idot8(const int8_t *W, const int16_t *X, uint32_t N) {
+    return intKernels().idot8(W, X, N);
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
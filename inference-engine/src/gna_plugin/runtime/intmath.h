@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+// vectorized helpers of the integer runtime, the widest instruction set supported by the host is used,
+// results are exact, products are accumulated in 64 bits as GNA accumulator does before saturation
+int64_t idot16(const int16_t *W, const int16_t *X, uint32_t N);  // returns sum of W[i] * X[i]
+int64_t idot8(const int8_t *W, const int16_t *X, uint32_t N);    // returns sum of W[i] * X[i]
+
+/**
+ * @brief clamps value to the range of T as GNA does on storing outputs
+ * @param num_saturate incremented if value is clamped
+ */
+template <typename T>
+T saturate(int64_t value, uint32_t &num_saturate) {
+    if (value > std::numeric_limits<T>::max()) {
+        num_saturate++;
+        return std::numeric_limits<T>::max();
+    }
+    if (value < std::numeric_limits<T>::min()) {
+        num_saturate++;
+        return std::numeric_limits<T>::min();
+    }
+    return static_cast<T>(value);
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <ie_system_conf.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+enum class Isa {
+    AVX512F,
+    AVX2,
+    Scalar
+};
+
+// instruction sets the runtime is built with and the host supports, the widest one first
+inline const std::vector<Isa> &supportedIsas() {
+    static const std::vector<Isa> isas = [] {
+        std::vector<Isa> result;
+#ifdef HAVE_AVX512F
+        if (InferenceEngine::with_cpu_x86_avx512f()) {
+            result.push_back(Isa::AVX512F);
+        }
+#endif
+#ifdef HAVE_AVX2
+        if (InferenceEngine::with_cpu_x86_avx2()) {
+            result.push_back(Isa::AVX2);
+        }
+#endif
+        result.push_back(Isa::Scalar);
+        return result;
+    }();
+    return isas;
+}
+
+/**
+ * @brief selects kernels of the widest supported instruction set they are implemented for
+ * @param implementations kernels per instruction set, scalar ones are always present
+ */
+template <typename Kernels>
+Kernels selectKernels(const std::map<Isa, Kernels> &implementations) {
+    for (auto isa : supportedIsas()) {
+        auto kernels = implementations.find(isa);
+        if (kernels != implementations.end()) {
+            return kernels->second;
+        }
+    }
+    return implementations.at(Isa::Scalar);
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -26,6 +26,7 @@
 #endif
 
 #include "pwl.h"
+#include "pwl_design_cache.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -496,7 +497,7 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
 }
 
 
-void PwlDesignOpt(const DnnActivation activation_type,
+static void PwlDesignOptImpl(const DnnActivation activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
                     const float scale_in,
                     const float scale_out,
@@ -610,6 +611,23 @@ void PwlDesignOpt(const DnnActivation activation_type,
     }
 }
 
+void PwlDesignOpt(const DnnActivation activation_type,
+                    std::vector<gna_pwl_segment_t> &ptr_segment,
+                    const float scale_in,
+                    const float scale_out,
+                    const float pwlMaxErrorPercent,
+                    const bool low_precision) {
+    auto& cache = GNAPluginNS::runtime::PwlDesignCache::instance();
+    const auto key = GNAPluginNS::runtime::PwlDesignCache::key(activation_type, scale_in, scale_out,
+                                                                pwlMaxErrorPercent, low_precision);
+    if (cache.get(key, ptr_segment)) {
+        return;
+    }
+
+    PwlDesignOptImpl(activation_type, ptr_segment, scale_in, scale_out, pwlMaxErrorPercent, low_precision);
+    cache.put(key, ptr_segment);
+}
+
 void PwlDesign(const DnnActivation activation_type,
                  gna_pwl_segment_t *ptr_segment,
                  const uint32_t num_segments,
@@ -0,0 +1,191 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "gna_plugin_log.hpp"
+#include "pwl_design_cache.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+const char kCacheMagic[] = "GNAPWL01";
+// must be increased whenever the PWL design algorithm or the key layout changes, so stale designs are not reused
+const uint32_t kCacheVersion = 1;
+
+template <typename T>
+void append(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// only arguments of the activation function are appended, other bytes of the union are undefined
+void appendArgs(std::string& key, const DnnActivation& activation) {
+    switch (activation.type) {
+        case kActRelu:
+        case kActLeakyRelu:
+            append(key, activation.args.lrelu.negative_slope);
+            break;
+        case kActKaldiLstmClipping:
+            append(key, activation.args.clamp.low);
+            append(key, activation.args.clamp.high);
+            break;
+        case kActPow:
+            append(key, activation.args.pow.exponent);
+            append(key, activation.args.pow.scale);
+            append(key, activation.args.pow.offset);
+            break;
+        default:
+            break;
+    }
+}
+
+void appendFQ(std::string& key, const FakeQuantizeParams& fq) {
+    append(key, fq.set);
+    if (fq.set) {
+        append(key, fq.levels);
+        append(key, *fq.input_low);
+        append(key, *fq.input_high);
+    }
+}
+
+template <typename T>
+bool read(std::istream& stream, T& value) {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+PwlDesignCache& PwlDesignCache::instance() {
+    static PwlDesignCache cache;
+    return cache;
+}
+
+std::string PwlDesignCache::key(const DnnActivation& activation_type,
+                                float scale_in,
+                                float scale_out,
+                                float pwlMaxErrorPercent,
+                                bool low_precision) {
+    std::string key;
+    append(key, activation_type.type);
+    appendArgs(key, activation_type);
+    // only the first range values of fake quantize parameters are used by the design
+    appendFQ(key, activation_type.fqParams);
+    appendFQ(key, activation_type.srcFQParams);
+    append(key, scale_in);
+    append(key, scale_out);
+    append(key, pwlMaxErrorPercent);
+    append(key, low_precision);
+    return key;
+}
+
+bool PwlDesignCache::get(const std::string& key, std::vector<gna_pwl_segment_t>& segments) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto found = designs.find(key);
+    if (found == designs.end()) {
+        return false;
+    }
+    segments = found->second;
+    return true;
+}
+
+void PwlDesignCache::put(const std::string& key, const std::vector<gna_pwl_segment_t>& segments) {
+    std::lock_guard<std::mutex> lock(mtx);
+    designs.emplace(key, segments);
+}
+
+void PwlDesignCache::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return;
+    }
+
+    char magic[sizeof(kCacheMagic) - 1];
+    uint32_t version = 0;
+    uint64_t count = 0;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kCacheMagic, sizeof(magic)) != 0 || !read(file, version)) {
+        gnalog() << "Ignoring PWL design cache " << path << ": unknown format\n";
+        return;
+    }
+    if (version != kCacheVersion) {
+        gnalog() << "Ignoring PWL design cache " << path << ": unsupported version " << version << "\n";
+        return;
+    }
+    if (!read(file, count)) {
+        gnalog() << "Ignoring PWL design cache " << path << ": file is truncated\n";
+        return;
+    }
+
+    std::unordered_map<std::string, std::vector<gna_pwl_segment_t>> loaded;
+    for (uint64_t i = 0; i < count; i++) {
+        uint32_t key_size = 0, num_segments = 0;
+        if (!read(file, key_size)) {
+            break;
+        }
+        std::string key(key_size, '\0');
+        std::vector<gna_pwl_segment_t> segments;
+        if (!file.read(&key[0], key_size) || !read(file, num_segments)) {
+            break;
+        }
+        segments.resize(num_segments);
+        if (!file.read(reinterpret_cast<char*>(segments.data()), num_segments * sizeof(gna_pwl_segment_t))) {
+            break;
+        }
+        loaded.emplace(std::move(key), std::move(segments));
+    }
+    if (loaded.size() != count) {
+        gnalog() << "Ignoring PWL design cache " << path << ": file is truncated\n";
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    designs.insert(loaded.begin(), loaded.end());
+    auto& saved = savedSizes[path];
+    saved = std::max(saved, loaded.size());
+}
+
+void PwlDesignCache::save(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& saved = savedSizes[path];
+    if (saved >= designs.size()) {
+        return;
+    }
+
+    // the cache is written to a temporary file first, so concurrent readers never see a partial file
+    const auto tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            gnalog() << "Cannot write PWL design cache " << path << "\n";
+            return;
+        }
+        file.write(kCacheMagic, sizeof(kCacheMagic) - 1);
+        write(file, kCacheVersion);
+        write(file, static_cast<uint64_t>(designs.size()));
+        for (const auto& design : designs) {
+            write(file, static_cast<uint32_t>(design.first.size()));
+            file.write(design.first.data(), design.first.size());
+            write(file, static_cast<uint32_t>(design.second.size()));
+            file.write(reinterpret_cast<const char*>(design.second.data()), design.second.size() * sizeof(gna_pwl_segment_t));
+        }
+        if (!file) {
+            gnalog() << "Cannot write PWL design cache " << path << "\n";
+            return;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        gnalog() << "Cannot write PWL design cache " << path << "\n";
+        return;
+    }
+    saved = designs.size();
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "backend/dnn_types.h"
+#include "backend/gna_types.h"
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * Process wide cache of optimized PWL designs. Activation layers sharing activation function,
+ * scale factors and allowed error get segments designed once. The cache can be loaded from
+ * and saved to a file to be reused by next processes.
+ *
+ * Is a thread safe
+ */
+class PwlDesignCache {
+public:
+    /**
+     * The cache shared by all networks loaded in the process
+     */
+    static PwlDesignCache& instance();
+
+    static std::string key(const DnnActivation& activation_type,
+                           float scale_in,
+                           float scale_out,
+                           float pwlMaxErrorPercent,
+                           bool low_precision);
+
+    bool get(const std::string& key, std::vector<gna_pwl_segment_t>& segments) const;
+    void put(const std::string& key, const std::vector<gna_pwl_segment_t>& segments);
+
+    /**
+     * Adds designs stored in the file, does nothing if the file doesn't exist or is not a PWL design cache
+     */
+    void load(const std::string& path);
+    /**
+     * Stores all designs to the file if there are designs which are not stored there yet
+     */
+    void save(const std::string& path);
+
+private:
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, std::vector<gna_pwl_segment_t>> designs;
+    std::unordered_map<std::string, size_t> savedSizes;
+};
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
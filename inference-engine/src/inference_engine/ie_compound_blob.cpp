@@ -43,12 +43,13 @@ TensorDesc verifyNV12BlobInput(const Blob::Ptr& y, const Blob::Ptr& uv) {
     const auto& yDesc = yMemoryBlob->getTensorDesc();
     const auto& uvDesc = uvMemoryBlob->getTensorDesc();
 
-    // check precision
-    if (yDesc.getPrecision() != Precision::U8) {
-        IE_THROW() << "Y plane precision must be U8, actual: " << yDesc.getPrecision();
+    // check precision: U8 for NV12 or U16 for P010 planes
+    if (yDesc.getPrecision() != Precision::U8 && yDesc.getPrecision() != Precision::U16) {
+        IE_THROW() << "Y plane precision must be U8 or U16, actual: " << yDesc.getPrecision();
     }
-    if (uvDesc.getPrecision() != Precision::U8) {
-        IE_THROW() << "UV plane precision must be U8, actual: " << uvDesc.getPrecision();
+    if (uvDesc.getPrecision() != yDesc.getPrecision()) {
+        IE_THROW() << "UV plane precision must be equal to Y plane precision " << yDesc.getPrecision()
+                           << ", actual: " << uvDesc.getPrecision();
     }
 
     // check layout
@@ -92,6 +92,28 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAZY_WEIGHTS_REPACKING) {
+            if (val == PluginConfigParams::YES) lazyWeightsRepacking = true;
+            else if (val == PluginConfigParams::NO) lazyWeightsRepacking = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAZY_WEIGHTS_REPACKING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES) collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwPerfCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY) {
+            if (val == PluginConfigParams::NO)
+                weightsNumaPolicy = NumaPolicy::None;
+            else if (val == PluginConfigInternalParams::REPLICATE)
+                weightsNumaPolicy = NumaPolicy::Bind;
+            else if (val == PluginConfigInternalParams::INTERLEAVE)
+                weightsNumaPolicy = NumaPolicy::Interleave;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                                   << ". Expected only NO/REPLICATE/INTERLEAVE";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -155,6 +177,25 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (lazyWeightsRepacking)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_LAZY_WEIGHTS_REPACKING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_LAZY_WEIGHTS_REPACKING, PluginConfigParams::NO });
+        if (collectHwPerfCounters)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::NO });
+        switch (weightsNumaPolicy) {
+            case NumaPolicy::None:
+                _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigParams::NO });
+            break;
+            case NumaPolicy::Bind:
+                _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigInternalParams::REPLICATE });
+            break;
+            case NumaPolicy::Interleave:
+                _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigInternalParams::INTERLEAVE });
+            break;
+        }
     }
 }
 
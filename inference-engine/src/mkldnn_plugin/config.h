@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "utils/numa_memory.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -25,6 +26,9 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    bool lazyWeightsRepacking = false;
+    bool collectHwPerfCounters = false;
+    NumaPolicy weightsNumaPolicy = NumaPolicy::None;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -146,6 +146,18 @@ int MKLDNNEdge::getOutputNum() {
 }
 
 void MKLDNNEdge::allocate(const void* mem_ptr) {
+    allocateMemory([mem_ptr](MKLDNNMemory& memory, const MKLDNNMemoryDesc& desc) {
+        memory.Create(desc, mem_ptr, false);  // no pads zeroing
+    });
+}
+
+void MKLDNNEdge::allocate(const NumaPlacement& placement) {
+    allocateMemory([&placement](MKLDNNMemory& memory, const MKLDNNMemoryDesc& desc) {
+        memory.Create(desc, placement);
+    });
+}
+
+void MKLDNNEdge::allocateMemory(const std::function<void(MKLDNNMemory&, const MKLDNNMemoryDesc&)>& create) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -164,7 +176,7 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
 
     auto parentPtr = getParent();
     memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
-    memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
+    create(*memoryPtr, MKLDNNMemoryDesc(inputDesc));
     status = Status::Allocated;
 }
 
@@ -198,8 +210,8 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
         return;
 
     if (weightsCache) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, &weightsCache] () {
+            allocate(weightsCache->getPlacement());
             return memoryPtr;
         };
 
@@ -46,6 +46,7 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
+    void allocate(const NumaPlacement& placement);
     void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
     void validate();
     void drop();
@@ -97,6 +98,7 @@ private:
     InferenceEngine::TensorDesc outputDesc;
 
     bool nodeCanChangeDesc(const std::shared_ptr<MKLDNNPlugin::MKLDNNNode>& node) const;
+    void allocateMemory(const std::function<void(MKLDNNMemory&, const MKLDNNMemoryDesc&)>& create);
 
     enum LOOK { LOOK_UP = 1, LOOK_DOWN = 2, LOOK_BOTH = LOOK_UP | LOOK_DOWN, LOOK_NO_RECURRENT = 4 };
 
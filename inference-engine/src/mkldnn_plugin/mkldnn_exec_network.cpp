@@ -15,6 +15,7 @@
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
@@ -38,12 +39,14 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const LoadTimeBreakdown::Ptr &loadTime) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights) {
+    _numaNodesWeights(numaNodesWeights),
+    _loadTime(loadTime ? loadTime : std::make_shared<LoadTimeBreakdown>()) {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
 
     // we are cloning network if we have statistics and we can transform network.
@@ -243,15 +246,41 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(_loadTime.get(), "create_graphs");
+        if (_cfg.streamExecutorConfig._streams != 0) {
+            for (auto&& task : tasks) {
+                task = [this] {
+                    MKLDNNExecNetwork::GetGraph();
+                };
+            }
+            _taskExecutor->runAndWait(tasks);
+        } else {
+            MKLDNNExecNetwork::GetGraph();
+        }
+    }
+
+    // Weights repacking postponed by the graphs is done by a separate single threaded executor,
+    // so it does not delay inference requests queued to the task executor. An inference runs the
+    // tasks of the layers it executes by itself and waits only for the ones being run in background.
+    if (_cfg.lazyWeightsRepacking) {
+        _weightsRepackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUWeightsRepackExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE,
+                                     1, 0, 1, IStreamsExecutor::Config::PreferredCoreType::LITTLE});
+        for (auto &graph : _graphs) {
+            for (auto &task : graph.GetDeferredTasks()) {
+                std::weak_ptr<DeferredTask> weakTask = task;
+                _weightsRepackExecutor->run([weakTask] {
+                    if (auto deferredTask = weakTask.lock()) {
+                        try {
+                            deferredTask->run();
+                        } catch (...) {
+                            // the error is reported again when an inference runs the task
+                        }
+                    }
+                });
+            }
         }
-        _taskExecutor->runAndWait(tasks);
-    } else {
-        MKLDNNExecNetwork::GetGraph();
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -289,11 +318,15 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         auto makeGraph = [&] {
             try {
                 auto localNetwork = cloneNetwork(_clonedNetwork);
+                NumaPolicy weightsNumaPolicy;
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    graphLock._graph.setLoadTimeBreakdown(_loadTime);
+                    weightsNumaPolicy = _cfg.weightsNumaPolicy;
                 }
-                graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(localNetwork, extensionManager,
+                                             _numaNodesWeights.get(numaNodeId, weightsNumaPolicy));
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -373,6 +406,8 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_LOAD_TIME_BREAKDOWN) {
+        return _loadTime->get();
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
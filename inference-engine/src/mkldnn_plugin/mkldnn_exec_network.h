@@ -8,7 +8,9 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "utils/load_time_breakdown.hpp"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_istreams_executor.hpp>
 
 #include <vector>
 #include <memory>
@@ -30,7 +32,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const LoadTimeBreakdown::Ptr &loadTime = nullptr);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -61,9 +64,12 @@ protected:
             Graph&                          _graph;
         };
     };
+    // runs the work postponed by lazy weights repacking, declared before the graphs to outlive them
+    InferenceEngine::IStreamsExecutor::Ptr      _weightsRepackExecutor;
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    LoadTimeBreakdown::Ptr                      _loadTime;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
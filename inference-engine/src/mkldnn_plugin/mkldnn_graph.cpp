@@ -103,8 +103,12 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsPlacement = w_cache ? w_cache->getPlacement() : NumaPlacement{};
 
-    Replicate(net, extMgr);
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime.get(), "graph_replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
     status = Ready;
 }
@@ -340,23 +344,39 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
+    auto loadTimePtr = loadTime.get();
 
-    SortTopologically();
-    InitNodes();
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "graph_init_nodes");
+        SortTopologically();
+        InitNodes();
+    }
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "graph_optimization");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    InitDescriptors();
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "graph_init_descriptors");
+        InitDescriptors();
 
-    InitOptimalPrimitiveDescriptors();
+        InitOptimalPrimitiveDescriptors();
 
-    InitEdges();
+        InitEdges();
+    }
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
-    SortTopologically();
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "graph_optimization");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    Allocate();
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "graph_memory_allocation");
+        Allocate();
+    }
 
     CreatePrimitives();
 
@@ -389,6 +409,7 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    LoadTimeBreakdown::Scope loadTimeScope(loadTimePtr, "constant_nodes_execution");
     ExecuteConstantNodesOnly();
 }
 
@@ -459,7 +480,6 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
-    mkldnn::stream stream(eng);
 
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
 
@@ -485,10 +505,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
-
+    auto executeConstantNode = [this, acquireSharedOutputs](MKLDNNNodePtr & graphNode, mkldnn::stream & stream) {
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(graphNode);
 
@@ -501,7 +518,73 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         } else {
             graphNode->execute(stream);
         }
+    };
+
+    if (config.lazyWeightsRepacking) {
+        // Constant subgraphs are executed on demand (see RunDeferredTasks) or in background,
+        // so the task of a node has to complete the tasks of all its constant inputs first
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+
+            std::vector<DeferredTask::Ptr> prerequisites;
+            for (size_t i = 0; i < graphNode->getParentEdges().size(); i++) {
+                auto parent = graphNode->getParentEdgeAt(i)->getParent();
+                prerequisites.insert(prerequisites.end(), parent->deferredTasks.begin(), parent->deferredTasks.end());
+            }
+            prerequisites.insert(prerequisites.end(), graphNode->deferredTasks.begin(), graphNode->deferredTasks.end());
+
+            std::weak_ptr<MKLDNNNode> weakNode = graphNode;
+            graphNode->deferredTasks.push_back(std::make_shared<DeferredTask>([weakNode, prerequisites, executeConstantNode] {
+                for (auto &task : prerequisites)
+                    task->run();
+
+                if (auto node = weakNode.lock()) {
+                    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+                    mkldnn::stream stream(eng);
+                    executeConstantNode(node, stream);
+                }
+            }));
+        }
+        hasDeferredTasks = true;
+        return;
+    }
+
+    mkldnn::stream stream(eng);
+    for (auto &graphNode : graphNodes) {
+        if (!graphNode->isConstant())
+            continue;
+
+        executeConstantNode(graphNode, stream);
+    }
+}
+
+std::vector<DeferredTask::Ptr> MKLDNNGraph::GetDeferredTasks() const {
+    std::vector<DeferredTask::Ptr> tasks;
+    for (auto &graphNode : graphNodes)
+        tasks.insert(tasks.end(), graphNode->deferredTasks.begin(), graphNode->deferredTasks.end());
+    return tasks;
+}
+
+void MKLDNNGraph::RunDeferredTasks(const MKLDNNNodePtr &node) {
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto parent = node->getParentEdgeAt(i)->getParent();
+        if (parent->isConstant()) {
+            for (auto &task : parent->deferredTasks)
+                task->run();
+        }
+    }
+    for (auto &task : node->deferredTasks)
+        task->run();
+}
+
+void MKLDNNGraph::CancelDeferredTasks() {
+    for (auto &graphNode : graphNodes) {
+        for (auto &task : graphNode->deferredTasks)
+            task->cancel();
+        graphNode->deferredTasks.clear();
     }
+    hasDeferredTasks = false;
 }
 
 static bool isReorderAvailable(const TensorDesc& parentDesc, const TensorDesc& childDesc, const mkldnn::engine& eng) {
@@ -758,9 +841,20 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
+    const auto start = LoadTimeBreakdown::Clock::now();
+    LoadTimeBreakdown::Clock::duration weightsPreparation {0};
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        node->lazyWeightsRepacking = config.lazyWeightsRepacking;
+        node->weightsPlacement = weightsPlacement;
+        node->weightsPreparationTime = LoadTimeBreakdown::Clock::duration {0};
         node->createPrimitive();
+        weightsPreparation += node->weightsPreparationTime;
+    }
+    if (loadTime) {
+        // weights are repacked by prepareMemory() while the primitives are created
+        loadTime->add("weights_repacking", weightsPreparation);
+        loadTime->add("primitive_creation", LoadTimeBreakdown::Clock::now() - start - weightsPreparation);
     }
 }
 
@@ -858,6 +952,7 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
             request->ThrowIfCanceled();
         }
 
+        HwPerfHelper hwPerfHelper(config.collectHwPerfCounters ? &graphNodes[i]->HwPerfCounter() : nullptr);
         PERF(graphNodes[i]);
 
         if (batch > 0)
@@ -866,12 +961,24 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
         if (!graphNodes[i]->isConstant()) {
+            if (hasDeferredTasks)
+                RunDeferredTasks(graphNodes[i]);
+
             OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
             graphNodes[i]->execute(stream);
         }
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
+    if (hasDeferredTasks) {
+        // constant outputs and the rest of the background work are completed by the first inference
+        for (auto &task : GetDeferredTasks())
+            task->run();
+        for (auto &graphNode : graphNodes)
+            graphNode->deferredTasks.clear();
+        hasDeferredTasks = false;
+    }
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -969,8 +1076,9 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
-                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        // nodes faster than a microsecond are executed as well
+        pc.status = node->PerfCounter().count() > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
@@ -12,6 +12,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include "utils/load_time_breakdown.hpp"
 #include <map>
 #include <string>
 #include <vector>
@@ -24,6 +25,7 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    NumaPlacement weightsPlacement;
 
     enum Status {
         NotReady = 0,
@@ -32,6 +34,10 @@ public:
 
     MKLDNNGraph() = default;
 
+    ~MKLDNNGraph() {
+        CancelDeferredTasks();
+    }
+
     Status GetStatus() {
         return status;
     }
@@ -41,6 +47,9 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    void setLoadTimeBreakdown(const LoadTimeBreakdown::Ptr &breakdown) {
+        loadTime = breakdown;
+    }
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -159,10 +168,18 @@ public:
 
     void SortTopologically();
 
+    /**
+     * @brief Returns the pending work of the lazy weights repacking mode in execution order.
+     * The tasks may be run from any thread, e.g. by a background executor, while the graph is in use.
+     * @return list of tasks, empty when there is nothing left to do
+     */
+    std::vector<DeferredTask::Ptr> GetDeferredTasks() const;
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
     void ForgetGraphData() {
+        CancelDeferredTasks();
         status = NotReady;
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
 
@@ -174,6 +191,8 @@ protected:
     }
     Status status { NotReady };
     Config config;
+    // durations of the graph creation phases are added here if set
+    LoadTimeBreakdown::Ptr loadTime;
 
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
@@ -181,6 +200,9 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    // true until the first inference completes the work postponed by lazy weights repacking
+    bool hasDeferredTasks = false;
+
     MKLDNNMemoryPtr memWorkspace;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
@@ -205,6 +227,8 @@ protected:
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void RunDeferredTasks(const MKLDNNNodePtr &node);
+    void CancelDeferredTasks();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -14,6 +14,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <utility>
 #include <map>
 
 using namespace InferenceEngine;
@@ -276,12 +277,35 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     serialization_info[ExecGraphInfoSerialization::OUTPUT_LAYOUTS] = outputLayoutsStr;
 
     // Performance
-    if (node->PerfCounter().avg() != 0) {
-        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+    const auto& perfCounter = node->PerfCounter();
+    if (perfCounter.count() != 0) {
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(perfCounter.avg());
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P50] = std::to_string(perfCounter.percentile_ns(0.5));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P90] = std::to_string(perfCounter.percentile_ns(0.9));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P99] = std::to_string(perfCounter.percentile_ns(0.99));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_MAX] = std::to_string(perfCounter.max_ns());
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_NUM] = std::to_string(perfCounter.count());
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    const auto& hwPerfCounter = node->HwPerfCounter();
+    if (hwPerfCounter.count() != 0) {
+        const std::pair<HwCounter, const char*> hwCounters[] = {
+            {HwCounter::Cycles, ExecGraphInfoSerialization::HW_CYCLES},
+            {HwCounter::Instructions, ExecGraphInfoSerialization::HW_INSTRUCTIONS},
+            {HwCounter::LlcMisses, ExecGraphInfoSerialization::HW_LLC_MISSES},
+            {HwCounter::BackendStalls, ExecGraphInfoSerialization::HW_BACKEND_STALLS},
+        };
+        for (const auto& hwCounter : hwCounters) {
+            if (hwPerfCounter.isAvailable(hwCounter.first))
+                serialization_info[hwCounter.second] = std::to_string(hwPerfCounter.avg(hwCounter.first));
+        }
+    }
+
+    serialization_info[ExecGraphInfoSerialization::BYTES_READ] = std::to_string(node->getBytesRead());
+    serialization_info[ExecGraphInfoSerialization::BYTES_WRITTEN] = std::to_string(node->getBytesWritten());
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
@@ -102,6 +102,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
+        // already written into the graph input memory by pre-processing
+        if (normalizedInputs.count(input.first))
+            continue;
+
         auto inPrec = input.second->getTensorDesc().getPrecision();
 
         switch (inPrec) {
@@ -142,6 +146,51 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::canNormalizeInPreprocessing(const std::string& inputName,
+                                                                   const InferenceEngine::Blob::Ptr& graphInput) const {
+    if (_preProcData.find(inputName) == _preProcData.end() || !graph->hasMeanImageFor(inputName))
+        return false;
+
+    const auto& info = _networkInputs.at(inputName)->getPreProcess();
+    if (info.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+
+    // mean image subtraction of the plugin doesn't apply scales, so keep the results the same
+    for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+        if (info[c]->stdScale != 1.0f)
+            return false;
+    }
+
+    // pre-processing writes FP32 data in planar or interleaved layout only
+    const auto& desc = graphInput->getTensorDesc();
+    return desc.getPrecision() == InferenceEngine::Precision::FP32 &&
+           (desc.getLayout() == InferenceEngine::NCHW || desc.getLayout() == InferenceEngine::NHWC);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::execDataPreprocessingNormalized() {
+    // Pre-processing of inputs with mean values subtracts them and converts the data to FP32 in the same pass,
+    // writing the result directly into the graph input memory. It saves separate passes of precision
+    // conversion, copying into the graph and mean subtraction
+    normalizedInputs.clear();
+
+    InferenceEngine::BlobMap graphInputs;
+    graph->getInputBlobs(graphInputs);
+
+    InferenceEngine::BlobMap preprocessedInputs;
+    for (auto& input : _inputs) {
+        auto graphInput = graphInputs.find(input.first);
+        if (graphInput != graphInputs.end() && canNormalizeInPreprocessing(input.first, graphInput->second)) {
+            _preProcData[input.first]->execute(graphInput->second, _networkInputs[input.first]->getPreProcess(),
+                                               false, m_curBatch, true);
+            normalizedInputs.insert(input.first);
+        } else {
+            preprocessedInputs.insert(input);
+        }
+    }
+
+    execDataPreprocessing(preprocessedInputs);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
@@ -189,7 +238,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
+    execDataPreprocessingNormalized();
 
     changeDefaultPtr();
 
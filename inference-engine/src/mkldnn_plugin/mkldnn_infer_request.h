@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -55,9 +56,14 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+
+    bool canNormalizeInPreprocessing(const std::string& inputName, const InferenceEngine::Blob::Ptr& graphInput) const;
+    void execDataPreprocessingNormalized();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    std::set<std::string>               normalizedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
@@ -60,6 +60,7 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
+    placedData.reset();
     if (data == nullptr) {
         prim.reset(new memory(desc, eng));
 
@@ -89,6 +90,12 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const NumaPlacement& placement) {
+    auto data = allocateNumaMemory(desc.get_size(), placement);
+    Create(desc, data.get());
+    placedData = data;
+}
+
 void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size) {
     if (size != 0)
         IE_ASSERT(size <= output.GetDescriptor().get_size());
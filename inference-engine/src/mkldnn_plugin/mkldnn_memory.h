@@ -6,6 +6,7 @@
 
 #include "ie_layouts.h"
 #include "mkldnn_dims.h"
+#include "utils/numa_memory.hpp"
 #include <mkldnn.hpp>
 #include <mkldnn_types.h>
 
@@ -150,6 +151,9 @@ public:
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
 
+    // Allocates own buffer with the pages placed on NUMA nodes according to the placement
+    void Create(const mkldnn::memory::desc& desc, const NumaPlacement& placement);
+
     // Like a plain format
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format_tag format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
@@ -168,6 +172,7 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    std::shared_ptr<void> placedData;
     mkldnn::engine eng;
 };
 
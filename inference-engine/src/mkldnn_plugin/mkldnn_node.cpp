@@ -686,7 +686,9 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
     InferenceEngine::TensorDesc desc(blb->getTensorDesc().getPrecision(), dims, intLayout);
 
+    std::vector<InferenceEngine::Blob::Ptr> sourceBlobs;
     auto fillInternalBlob = [&](char *data, size_t intBuffSize) {
+        sourceBlobs.push_back(blb);
         size_t offset = blb->byteSize();
         checkSize(intBuffSize, offset);
         cpu_memcpy_s(data, intBuffSize, blb->buffer(), blb->byteSize());
@@ -700,6 +702,7 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
             if (blb == nullptr)
                 IE_THROW() << "Cannot get internal blob layer for node " << getName() << ".";
+            sourceBlobs.push_back(blb);
             offset += blb->byteSize();
             checkSize(intBuffSize, offset);
             cpu_memcpy_s(data, intBuffSize, blb->buffer(), blb->byteSize());
@@ -725,10 +728,20 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
     fillInternalBlob(data, intBuffSize);
 
+    if (weightCache != nullptr) {
+        // The internal blob is a concatenation of the layer blobs, which are shared between streams and networks,
+        // so hashes of the latter (memorized by the hash function) identify the content without rehashing
+        std::vector<uint64_t> hashes;
+        for (const auto &source : sourceBlobs)
+            hashes.push_back(weightCache->GetHashFunc().hash(source));
+        internalBlobsHash[internalBlob.get()] = weightCache->GetHashFunc().combine(hashes);
+    }
+
     return internalBlob;
 }
 
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
+    const auto start = LoadTimeBreakdown::Clock::now();
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
         if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
@@ -749,35 +762,57 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
-        auto create = [&] () {
+        // the blob is captured by value, because the deferred repacking may outlive node cleanup
+        const mkldnn::engine eng = engine;
+        auto fill = [internalBlob, eng] (MKLDNNMemory& dst) {
             auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
 
-            MKLDNNMemory memory{ engine };
+            MKLDNNMemory memory{ eng };
             memory.Create(newDesc, internalBlob->buffer());
 
+            dst.SetData(memory);
+        };
+
+        auto create = [&] () {
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
-            _ptr->SetData(memory);
+            _ptr->Create(intDescs[i], weightsPlacement);
+            if (!lazyWeightsRepacking)
+                fill(*_ptr);
 
             return _ptr;
         };
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            auto knownHash = internalBlobsHash.find(internalBlob.get());
+            const uint64_t data_hash = knownHash != internalBlobsHash.end()
+                                       ? knownHash->second
+                                       : weightCache->GetHashFunc().hash(internalBlob->cbuffer().as<const unsigned char*>(),
+                                                                         internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            auto sharedMemory = weightCache->findOrCreate(string_hash, create, true,
+                                                          lazyWeightsRepacking ? fill : std::function<void(MKLDNNMemory&)>());
+            ptr = *sharedMemory;
+            if (auto initTask = sharedMemory->getInitTask())
+                deferredTasks.push_back(initTask);
         } else {
             ptr = create();
+            if (lazyWeightsRepacking) {
+                std::weak_ptr<MKLDNNMemory> weakPtr = ptr;
+                deferredTasks.push_back(std::make_shared<DeferredTask>([weakPtr, fill] {
+                    if (auto memory = weakPtr.lock())
+                        fill(*memory);
+                }));
+            }
         }
 
         internalBlobMemory.push_back(ptr);
     }
+    weightsPreparationTime += LoadTimeBreakdown::Clock::now() - start;
 }
 
 bool MKLDNNNode::isInplace() const {
@@ -846,6 +881,7 @@ void MKLDNNNode::addOriginalLayer(const InferenceEngine::CNNLayerPtr &layer) {
 
 void MKLDNNNode::cleanup() {
     internalBlobs.clear();
+    internalBlobsHash.clear();
     cnnLayer.reset();
 
     for (auto it : fusedWith) {
@@ -1183,6 +1219,30 @@ InferenceEngine::Precision MKLDNNNode::getRuntimePrecision() const {
     return runtimePrecision;
 }
 
+size_t MKLDNNNode::getBytesRead() const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        if (parentEdge && parentEdge->getStatus() == MKLDNNEdge::Status::Validated)
+            bytes += parentEdge->getMemoryPtr()->GetSize();
+    }
+    for (const auto& memory : internalBlobMemory) {
+        if (memory)
+            bytes += memory->GetSize();
+    }
+    return bytes;
+}
+
+size_t MKLDNNNode::getBytesWritten() const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto childEdge = getChildEdgeAt(i);
+        if (childEdge && childEdge->getStatus() == MKLDNNEdge::Status::Validated)
+            bytes += childEdge->getMemoryPtr()->GetSize();
+    }
+    return bytes;
+}
+
 MKLDNNNode* MKLDNNNode::NodesFactory::create(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
                                              const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache) {
     MKLDNNNode *newNode = nullptr;
@@ -21,6 +21,9 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "utils/deferred_task.hpp"
+#include "utils/hw_perf_counters.hpp"
+#include "utils/load_time_breakdown.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include <ngraph/node.hpp>
@@ -407,6 +410,8 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    HwPerfCount &HwPerfCounter() { return hwPerfCounter; }
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -529,6 +534,13 @@ public:
      */
     virtual InferenceEngine::Precision getRuntimePrecision() const;
 
+    /**
+     * @brief Estimates memory traffic of a single node execution: inputs and internal blobs (weights) are read, outputs are written
+     * @return Number of bytes. Edges which are not initialized yet aren't counted.
+     */
+    size_t getBytesRead() const;
+    size_t getBytesWritten() const;
+
 protected:
     // TODO: It is necessary only in order to avoid modifications of cnnLayers and original topology
     std::vector<MKLDNNDims> outDims;
@@ -577,6 +589,7 @@ protected:
     };
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
+    std::unordered_map<const InferenceEngine::Blob*, uint64_t> internalBlobsHash;  // content hashes known by construction
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
@@ -586,6 +599,14 @@ protected:
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
 
+    NumaPlacement weightsPlacement;
+
+    // If set, internal blobs are repacked by deferredTasks, which must be run before the node is executed
+    bool lazyWeightsRepacking = false;
+    std::vector<DeferredTask::Ptr> deferredTasks;
+    // time spent by prepareMemory() on the last createPrimitive() call
+    LoadTimeBreakdown::Clock::duration weightsPreparationTime {0};
+
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
@@ -631,6 +652,7 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    HwPerfCount hwPerfCounter;
     PerfCounters profiling;
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
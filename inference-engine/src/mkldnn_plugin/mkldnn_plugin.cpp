@@ -7,11 +7,13 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "utils/load_time_breakdown.hpp"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
@@ -112,7 +114,7 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf, LoadTimeBreakdown* loadTime) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
@@ -295,11 +297,15 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         });
     }
 
-    manager.run_passes(nGraphFunc);
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime, "ngraph_transformations");
+        manager.run_passes(nGraphFunc);
+    }
 
     using namespace ngraph::pass::low_precision;
     if (useLpt) {
         OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "LowPrecisionTransformations");
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime, "low_precision_transformations");
 
         ngraph::pass::Manager manager;
         auto lptPrerequisites = manager.register_pass<ngraph::pass::GraphRewrite>();
@@ -361,11 +367,17 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         return node->get_rt_info().count("UNROLL_TI") == 0;
     });
 
-    legacyManager.run_passes(nGraphFunc);
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime, "legacy_transformations");
+        legacyManager.run_passes(nGraphFunc);
+    }
 
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "Transformation", "convertFunctionToICNNNetwork");
 
-    clonedNetwork = CNNNetwork(InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, clonedNetwork, has_fake_quantize));
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime, "legacy_conversion");
+        clonedNetwork = CNNNetwork(InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, clonedNetwork, has_fake_quantize));
+    }
 
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConvertIOPrecision");
 
@@ -411,11 +423,16 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
+    auto loadTime = std::make_shared<LoadTimeBreakdown>();
+    CNNNetwork clonedNetwork;
+    {
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime.get(), "clone_network");
+        clonedNetwork = InferenceEngine::cloneNetwork(network);
+    }
 
     bool is_transformed = false;
     if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
+        Transformation(clonedNetwork, conf, loadTime.get());
         is_transformed = true;
     }
     IE_SUPPRESS_DEPRECATED_START
@@ -424,6 +441,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
     if (implNetwork) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        LoadTimeBreakdown::Scope loadTimeScope(loadTime.get(), "cnn_const_folding");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
@@ -440,7 +458,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, loadTime);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -529,6 +547,13 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_WEIGHTS_BYTES_PER_NUMA_NODE) {
+        std::map<int, uint64_t> weightsBytes;
+        for (auto numa_id : getNumaTopology()->nodes())
+            weightsBytes[numa_id] = 0;
+        for (auto& usage : getNumaMemoryUsage())
+            weightsBytes[usage.first] += usage.second;
+        return weightsBytes;
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -5,11 +5,150 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <cstring>
 #include <memory>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+namespace {
+
+const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t round64(uint64_t acc, uint64_t input) {
+    acc += input * PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * PRIME64_1;
+}
+
+inline uint64_t mergeRound64(uint64_t acc, uint64_t val) {
+    acc ^= round64(0, val);
+    return acc * PRIME64_1 + PRIME64_4;
+}
+
+// XXH64 reference algorithm; four independent accumulators keep the CPU pipelines busy
+uint64_t xxh64(const unsigned char* p, size_t len, uint64_t seed) {
+    const unsigned char* const end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        const unsigned char* const limit = end - 32;
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+        do {
+            v1 = round64(v1, read64(p));
+            v2 = round64(v2, read64(p + 8));
+            v3 = round64(v3, read64(p + 16));
+            v4 = round64(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = mergeRound64(h, v1);
+        h = mergeRound64(h, v2);
+        h = mergeRound64(h, v3);
+        h = mergeRound64(h, v4);
+    } else {
+        h = seed + PRIME64_5;
+    }
+
+    h += static_cast<uint64_t>(len);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= round64(0, read64(p));
+        h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME64_1;
+        h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * PRIME64_5;
+        h = rotl64(h, 11) * PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return xxh64(data, size, 0);
+
+    // chunks are hashed independently (the index is used as a seed), then the chunk hashes are hashed
+    const size_t chunks = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> hashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        hashes[i] = xxh64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+
+    return xxh64(reinterpret_cast<const unsigned char*>(hashes.data()), chunks * sizeof(uint64_t), size);
+}
+
+uint64_t SimpleDataHash::hash(const InferenceEngine::Blob::Ptr& blob) const {
+    const unsigned char* data = blob->cbuffer().as<const unsigned char*>();
+    const auto key = std::make_pair(static_cast<const void*>(data), blob->byteSize());
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = cache.find(key);
+        // an expired owner means that the address may be reused by other data
+        if (found != cache.end() && !found->second.blob.expired())
+            return found->second.hash;
+    }
+
+    const uint64_t result = hash(data, key.second);
+
+    std::lock_guard<std::mutex> lock(guard);
+    cache[key] = CachedHash{blob, result};
+    if (cache.size() > sweepThreshold) {
+        for (auto it = cache.begin(); it != cache.end();) {
+            if (it->second.blob.expired())
+                it = cache.erase(it);
+            else
+                ++it;
+        }
+        sweepThreshold = std::max(sweepThreshold, 2 * cache.size());
+    }
+    return result;
+}
+
+uint64_t SimpleDataHash::combine(const std::vector<uint64_t>& hashes) const {
+    if (hashes.size() == 1)
+        return hashes.front();
+    return xxh64(reinterpret_cast<const unsigned char*>(hashes.data()), hashes.size() * sizeof(uint64_t), hashes.size());
+}
+
+const SimpleDataHash MKLDNNWeightsSharing::weightsHash;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -32,10 +171,15 @@ void MKLDNNWeightsSharing::MKLDNNSharedMemory::valid(bool b) {
     memory->valid = b;
 }
 
+DeferredTask::Ptr MKLDNNWeightsSharing::MKLDNNSharedMemory::getInitTask() const {
+    return memory->initTask;
+}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
-                            bool valid) {
+                            bool valid,
+                            std::function<void(MKLDNNMemory&)> init) {
     std::unique_lock<std::mutex> lock(guard);
     auto found = sharedWeights.find(key);
 
@@ -47,6 +191,13 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         || ptr->sharedMemory.expired()) {
         newPtr = create();
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
+        if (init) {
+            std::weak_ptr<MKLDNNMemory> weakPtr = newPtr;
+            ptr->initTask = std::make_shared<DeferredTask>([weakPtr, init] {
+                if (auto memory = weakPtr.lock())
+                    init(*memory);
+            }, false);
+        }
         sharedWeights[key] = ptr;
     }
 
@@ -72,8 +223,11 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 }
 
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    for (auto numa_id : getNumaTopology()->nodes()) {
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(NumaPlacement{NumaPolicy::None, numa_id});
+        _bound_cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(NumaPlacement{NumaPolicy::Bind, numa_id});
+    }
+    _interleaved_cache = std::make_shared<MKLDNNWeightsSharing>(NumaPlacement{NumaPolicy::Interleave, 0});
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -90,4 +244,15 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numa_id, NumaPolicy policy) {
+    if (policy == NumaPolicy::Interleave)
+        return _interleaved_cache;
+
+    auto& cache_map = policy == NumaPolicy::Bind ? _bound_cache_map : _cache_map;
+    auto found = cache_map.find(numa_id);
+    if (found == cache_map.end())
+        IE_THROW() << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
 }  // namespace MKLDNNPlugin
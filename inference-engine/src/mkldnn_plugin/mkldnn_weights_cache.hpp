@@ -5,6 +5,8 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ie_blob.h>
+#include "utils/deferred_task.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -12,6 +14,8 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <vector>
+#include <utility>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -23,26 +27,27 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    // Computes 64-bit non-cryptographic hash of the data (XXH64 of data chunks processed in parallel)
+    uint64_t hash(const unsigned char* data, size_t size) const;
+
+    // Same as above, but the result is memorized while the blob is alive, so the constants
+    // shared by several streams or networks are hashed only once
+    uint64_t hash(const InferenceEngine::Blob::Ptr& blob) const;
+
+    // Hash of the sequence of hashes, e.g. of the data concatenated from several blobs
+    uint64_t combine(const std::vector<uint64_t>& hashes) const;
 
 protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const size_t kChunkSize = 1 << 20;
+
+    struct CachedHash {
+        std::weak_ptr<InferenceEngine::Blob> blob;
+        uint64_t hash;
+    };
+
+    mutable std::mutex guard;
+    mutable std::map<std::pair<const void*, size_t>, CachedHash> cache;
+    mutable size_t sweepThreshold = 1024;
 };
 
 /**
@@ -63,11 +68,17 @@ class MKLDNNWeightsSharing {
         std::mutex guard;
         std::weak_ptr<MKLDNNMemory> sharedMemory;
         bool valid;
+        DeferredTask::Ptr initTask;
     };
 
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    explicit MKLDNNWeightsSharing(const NumaPlacement& placement = {}) : placement(placement) {}
+
+    // Placement of the memory stored in the cache
+    const NumaPlacement& getPlacement() const { return placement; }
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -79,6 +90,7 @@ public:
         operator MKLDNNMemoryPtr() const;
         bool isValid() const;
         void valid(bool b);
+        DeferredTask::Ptr getInitTask() const;
 
     private:
         std::unique_lock<std::mutex> lock;
@@ -86,18 +98,25 @@ public:
         MKLDNNMemoryPtr newPtr;
     };
 
+    /**
+     * If 'init' is specified, the created memory is filled by a deferred task shared by all users of the entry
+     * (see MKLDNNSharedMemory::getInitTask), so the data must not be accessed before this task is run.
+     * The task can't be cancelled by one of the users, it does nothing once the memory is released by all of them.
+     */
     MKLDNNSharedMemory::Ptr findOrCreate(const std::string& key,
                                          std::function<MKLDNNMemoryPtr(void)> create,
-                                         bool valid = true);
+                                         bool valid = true,
+                                         std::function<void(MKLDNNMemory&)> init = nullptr);
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const SimpleDataHash& GetHashFunc () { return weightsHash; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    NumaPlacement placement;
+    static const SimpleDataHash weightsHash;
 };
 
 /**
@@ -112,8 +131,14 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    // Returns the store for streams on the given NUMA node, which places memory according to the policy.
+    // All nodes share the same store for the interleave policy.
+    MKLDNNWeightsSharing::Ptr& get(int numa_id, NumaPolicy policy);
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::map<int, MKLDNNWeightsSharing::Ptr> _bound_cache_map;
+    MKLDNNWeightsSharing::Ptr _interleaved_cache;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,8 +3,10 @@
 //
 
 #include "base.hpp"
+#include "nms_imp.hpp"
 
 #include <cfloat>
+#include <cstdint>
 #include <vector>
 #include <cmath>
 #include <string>
@@ -19,7 +21,7 @@ namespace Cpu {
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -112,6 +114,9 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            _decode_mask.resize(static_cast<size_t>(_num) * _num_loc_classes * _num_priors);
+            _nms_scratch.resize(_num_classes);
+
             std::vector<DataConfigurator> in_data_conf(layer->insData.size(), DataConfigurator(ConfLayout::PLN, Precision::FP32));
             addConfig(layer, in_data_conf, {DataConfigurator(ConfLayout::PLN, Precision::FP32)});
         } catch (InferenceEngine::Exception &ex) {
@@ -139,6 +144,31 @@ public:
         int *indices_data          = _indices->buffer().as<int *>();
         int *num_priors_actual     = _num_priors_actual->buffer().as<int *>();
 
+        // Confidences are reordered first, so only boxes which can pass the confidence threshold are decoded
+        auto is_confident = [&](int c, float conf) {
+            if (c == _background_label_id)
+                return false;
+            return _decrease_label_id ? conf >= _confidence_threshold : conf > _confidence_threshold;
+        };
+
+        parallel_for2d(N, _num_priors, [&](int n, int p) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + p*_num_classes;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + p;
+            uint8_t *pmask = _decode_mask.data() + n*_num_loc_classes*_num_priors + p;
+
+            const bool is_background = with_add_box_pred && arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score;
+            if (_share_location)
+                pmask[0] = 0;
+            for (int c = 0; c < _num_classes; ++c) {
+                const float conf = is_background ? (c == _background_label_id ? 1.0f : 0.0f) : pconf[c];
+                preordered[c*_num_priors] = conf;
+                if (_share_location)
+                    pmask[0] |= is_confident(c, conf);
+                else
+                    pmask[c*_num_priors] = is_confident(c, conf);
+            }
+        });
+
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
             const float *prior_variances = prior_data + _num_priors*_prior_size;
@@ -151,13 +181,14 @@ public:
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
+                const uint8_t *pmask = _decode_mask.data() + n*_num_priors;
 
                 if (with_add_box_pred) {
                     const float *p_arm_loc = arm_loc_data + n*4*_num_priors;
-                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, 0, 4, false);
                 } else {
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, _offset, _prior_size);
                 }
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
@@ -167,36 +198,13 @@ public:
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
                     float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
+                    const uint8_t *pmask = _decode_mask.data() + n*_num_loc_classes*_num_priors + c*_num_priors;
                     if (with_add_box_pred) {
                         const float *p_arm_loc = arm_loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, _offset, _prior_size);
+                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, 0, 4, false);
                     } else {
-                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                    }
-                }
-            }
-        }
-
-        if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
-                    }
-                }
-            }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pmask, num_priors_actual, n, _offset, _prior_size);
                     }
                 }
             }
@@ -212,7 +220,6 @@ public:
                 parallel_for(_num_classes, [&](int c) {
                     if (c != _background_label_id) {  // Ignore background class
                         int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
                         int *pdetections = detections_data + n*_num_classes + c;
 
                         const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
@@ -226,7 +233,7 @@ public:
                             psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                         }
 
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                        nms_cf(pconf, pboxes, psizes, _nms_scratch[c], pindices, *pdetections, num_priors_actual[n]);
                     }
                 });
             } else {
@@ -247,7 +254,8 @@ public:
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                auto& conf_index_class_map = _conf_index_class_map;
+                conf_index_class_map.clear();
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -261,8 +269,8 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                  conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -304,6 +312,7 @@ public:
             const int *pindices  = indices_data + n*_num_classes*_num_priors;
 
             for (int c = 0; c < _num_classes; ++c) {
+                const float *pclass_boxes = _share_location ? pboxes : pboxes + c*4*_num_priors;
                 for (int i = 0; i < detections_data[n*_num_classes + c]; ++i) {
                     int idx = pindices[c*_num_priors + i];
 
@@ -311,14 +320,10 @@ public:
                     dst_data[count * DETECTION_SIZE + 1] = static_cast<float>(_decrease_label_id ? c-1 : c);
                     dst_data[count * DETECTION_SIZE + 2] = pconf[c*_num_priors + idx];
 
-                    float xmin = _share_location ? pboxes[idx*4 + 0] :
-                                 pboxes[c*4*_num_priors + idx*4 + 0];
-                    float ymin = _share_location ? pboxes[idx*4 + 1] :
-                                 pboxes[c*4*_num_priors + idx*4 + 1];
-                    float xmax = _share_location ? pboxes[idx*4 + 2] :
-                                 pboxes[c*4*_num_priors + idx*4 + 2];
-                    float ymax = _share_location ? pboxes[idx*4 + 3] :
-                                 pboxes[c*4*_num_priors + idx*4 + 3];
+                    float xmin = pclass_boxes[0*_num_priors + idx];
+                    float ymin = pclass_boxes[1*_num_priors + idx];
+                    float xmax = pclass_boxes[2*_num_priors + idx];
+                    float ymax = pclass_boxes[3*_num_priors + idx];
 
                     if (_clip_after_nms) {
                         xmin = (std::max)(0.0f, (std::min)(1.0f, xmin));
@@ -386,12 +391,14 @@ private:
         CENTER_SIZE = 2,
     };
 
+    // Boxes are decoded into the planar layout (xmin, ymin, xmax, ymax planes) required by the vectorized NMS;
+    // boxes with the zero 'decode_mask' value can't pass the confidence threshold and are skipped
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
-                      bool decodeType = true); // after ARM = false
+                      float *decoded_bboxes, float *decoded_bbox_sizes, const uint8_t *decode_mask, int* num_priors_actual, int n,
+                      const int& offs, const int& pr_size, bool decodeType = true); // after ARM = false
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                nms_scratch &scratch, int *indices, int &detections, int num_priors_actual);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
@@ -403,6 +410,10 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+
+    std::vector<uint8_t> _decode_mask;
+    std::vector<nms_scratch> _nms_scratch;
+    std::vector<std::pair<float, std::pair<int, int>>> _conf_index_class_map;
 };
 
 struct ConfidenceComparator {
@@ -420,16 +431,17 @@ struct ConfidenceComparator {
 static inline float JaccardOverlap(const float *decoded_bbox,
                                    const float *bbox_sizes,
                                    const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
+                                   const int idx2,
+                                   const int num_priors) {
+    float xmin1 = decoded_bbox[0*num_priors + idx1];
+    float ymin1 = decoded_bbox[1*num_priors + idx1];
+    float xmax1 = decoded_bbox[2*num_priors + idx1];
+    float ymax1 = decoded_bbox[3*num_priors + idx1];
+
+    float xmin2 = decoded_bbox[0*num_priors + idx2];
+    float ymin2 = decoded_bbox[1*num_priors + idx2];
+    float xmax2 = decoded_bbox[2*num_priors + idx2];
+    float ymax2 = decoded_bbox[3*num_priors + idx2];
 
     if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
         return 0.0f;
@@ -459,6 +471,7 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        const float *variance_data,
                                        float *decoded_bboxes,
                                        float *decoded_bbox_sizes,
+                                       const uint8_t *decode_mask,
                                        int* num_priors_actual,
                                        int n,
                                        const int& offs,
@@ -476,15 +489,27 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         }
     }
     parallel_for(num_priors_actual[n], [&](int p) {
+        if (!decode_mask[p])
+            return;
+
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
         float new_ymax = 0.0f;
 
-        float prior_xmin = prior_data[p*pr_size + 0 + offs];
-        float prior_ymin = prior_data[p*pr_size + 1 + offs];
-        float prior_xmax = prior_data[p*pr_size + 2 + offs];
-        float prior_ymax = prior_data[p*pr_size + 3 + offs];
+        float prior_xmin, prior_ymin, prior_xmax, prior_ymax;
+        if (decodeType) {
+            prior_xmin = prior_data[p*pr_size + 0 + offs];
+            prior_ymin = prior_data[p*pr_size + 1 + offs];
+            prior_xmax = prior_data[p*pr_size + 2 + offs];
+            prior_ymax = prior_data[p*pr_size + 3 + offs];
+        } else {
+            // boxes refined by ARM are already decoded into the planar layout
+            prior_xmin = prior_data[0*_num_priors + p];
+            prior_ymin = prior_data[1*_num_priors + p];
+            prior_xmax = prior_data[2*_num_priors + p];
+            prior_ymax = prior_data[3*_num_priors + p];
+        }
 
         float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
         float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
@@ -547,10 +572,10 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
             new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
         }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
+        decoded_bboxes[0*_num_priors + p] = new_xmin;
+        decoded_bboxes[1*_num_priors + p] = new_ymin;
+        decoded_bboxes[2*_num_priors + p] = new_xmax;
+        decoded_bboxes[3*_num_priors + p] = new_ymax;
 
         decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
     });
@@ -559,41 +584,23 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
-                          int* buffer,
+                          nms_scratch& scratch,
                           int* indices,
                           int& detections,
                           int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
-
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
-
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
-    }
+    nms_boxes boxes = {bboxes, bboxes + _num_priors, bboxes + 2*_num_priors, bboxes + 3*_num_priors, sizes};
+
+    nms_conf conf;
+    conf.score_threshold = _confidence_threshold;
+    conf.iou_threshold = _nms_threshold;
+    conf.suppress_equal_iou = false;
+    conf.soft_nms_scale = 0.0f;
+    conf.top_k = _top_k;
+    conf.max_output_boxes = static_cast<size_t>(num_priors_actual);
+
+    size_t selected = 0;
+    XARCH::nms_exec(conf_data, num_priors_actual, boxes, conf, scratch, nullptr, indices, selected);
+    detections = static_cast<int>(selected);
 }
 
 void DetectionOutputImpl::nms_mx(const float* conf_data,
@@ -607,7 +614,10 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
     for (int i = 0; i < num_priors_actual; ++i) {
         float conf = -1;
         int id = 0;
+        // Class 0 is reserved by MXNet layout (labels are decreased on output)
         for (int c = 1; c < _num_classes; ++c) {
+            if (c == _background_label_id)
+                continue;
             float temp = conf_data[c*_num_priors + i];
             if (temp > conf) {
                 conf = temp;
@@ -634,15 +644,13 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         int &ndetection = detections[cls];
         int *pindices = indices + cls*_num_priors;
 
+        const float *pboxes = _share_location ? bboxes : bboxes + cls*4*_num_priors;
+        const float *psizes = _share_location ? sizes : sizes + cls*_num_priors;
+
         bool keep = true;
         for (int k = 0; k < ndetection; ++k) {
             const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
+            float overlap = JaccardOverlap(pboxes, psizes, prior, kept_idx, _num_priors);
             if (overlap > _nms_threshold) {
                 keep = false;
                 break;
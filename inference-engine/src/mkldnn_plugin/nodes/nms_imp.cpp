@@ -0,0 +1,291 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#include <cmath>
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// Sort of the filtered candidates is done in parallel starting from this number of boxes
+constexpr size_t parallel_sort_threshold = 4096;
+
+struct kept_boxes {
+    kept_boxes(std::vector<float>& data, size_t capacity) {
+        if (data.size() < 5 * capacity)
+            data.resize(5 * capacity);
+        x0 = data.data();
+        y0 = x0 + capacity;
+        x1 = y0 + capacity;
+        y1 = x1 + capacity;
+        area = y1 + capacity;
+    }
+
+    void push(const nms_boxes& boxes, int idx) {
+        x0[size] = boxes.x0[idx];
+        y0[size] = boxes.y0[idx];
+        x1[size] = boxes.x1[idx];
+        y1[size] = boxes.y1[idx];
+        area[size] = boxes.area[idx];
+        size++;
+    }
+
+    float *x0, *y0, *x1, *y1, *area;
+    size_t size = 0;
+};
+
+inline float intersection_over_union(float x0i, float y0i, float x1i, float y1i, float areai,
+                                     float x0j, float y0j, float x1j, float y1j, float areaj) {
+    const float width = (std::min)(x1i, x1j) - (std::max)(x0i, x0j);
+    const float height = (std::min)(y1i, y1j) - (std::max)(y0i, y0j);
+    if (width <= 0.f || height <= 0.f || areai <= 0.f || areaj <= 0.f)
+        return 0.f;
+
+    const float intersection_area = width * height;
+    return intersection_area / (areai + areaj - intersection_area);
+}
+
+// Checks the candidate box against kept boxes [begin, end) and exits as soon as any of them suppresses the candidate.
+// If 'ious' isn't null, IoU values for all checked boxes are stored there (it's filled only up to the suppressor).
+bool is_suppressed(const kept_boxes& kept, size_t begin, size_t end, const nms_boxes& boxes, int idx,
+                   const nms_conf& conf, float* ious) {
+    const float x0i = boxes.x0[idx];
+    const float y0i = boxes.y0[idx];
+    const float x1i = boxes.x1[idx];
+    const float y1i = boxes.y1[idx];
+    const float areai = boxes.area[idx];
+
+    size_t j = begin;
+
+#if defined(HAVE_AVX512F)
+    const __m512 vx0i = _mm512_set1_ps(x0i);
+    const __m512 vy0i = _mm512_set1_ps(y0i);
+    const __m512 vx1i = _mm512_set1_ps(x1i);
+    const __m512 vy1i = _mm512_set1_ps(y1i);
+    const __m512 vareai = _mm512_set1_ps(areai);
+    const __m512 vzero = _mm512_setzero_ps();
+    const __m512 vthreshold = _mm512_set1_ps(conf.iou_threshold);
+    const __mmask16 vcand_valid = _mm512_cmp_ps_mask(vareai, vzero, _CMP_GT_OQ);
+
+    for (; j + 16 <= end; j += 16) {
+        const __m512 vareaj = _mm512_loadu_ps(kept.area + j);
+        const __m512 vwidth = _mm512_sub_ps(_mm512_min_ps(vx1i, _mm512_loadu_ps(kept.x1 + j)),
+                                            _mm512_max_ps(vx0i, _mm512_loadu_ps(kept.x0 + j)));
+        const __m512 vheight = _mm512_sub_ps(_mm512_min_ps(vy1i, _mm512_loadu_ps(kept.y1 + j)),
+                                             _mm512_max_ps(vy0i, _mm512_loadu_ps(kept.y0 + j)));
+
+        __mmask16 vvalid = _mm512_mask_cmp_ps_mask(vcand_valid, vwidth, vzero, _CMP_GT_OQ);
+        vvalid = _mm512_mask_cmp_ps_mask(vvalid, vheight, vzero, _CMP_GT_OQ);
+        vvalid = _mm512_mask_cmp_ps_mask(vvalid, vareaj, vzero, _CMP_GT_OQ);
+
+        const __m512 vintersection = _mm512_mul_ps(vwidth, vheight);
+        const __m512 viou = _mm512_maskz_div_ps(vvalid, vintersection,
+                                                _mm512_sub_ps(_mm512_add_ps(vareai, vareaj), vintersection));
+        if (ious)
+            _mm512_storeu_ps(ious + j, viou);
+
+        const __mmask16 vsuppressed = conf.suppress_equal_iou ? _mm512_cmp_ps_mask(viou, vthreshold, _CMP_GE_OQ)
+                                                              : _mm512_cmp_ps_mask(viou, vthreshold, _CMP_GT_OQ);
+        if (vsuppressed)
+            return true;
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vx0i = _mm256_set1_ps(x0i);
+    const __m256 vy0i = _mm256_set1_ps(y0i);
+    const __m256 vx1i = _mm256_set1_ps(x1i);
+    const __m256 vy1i = _mm256_set1_ps(y1i);
+    const __m256 vareai = _mm256_set1_ps(areai);
+    const __m256 vzero = _mm256_setzero_ps();
+    const __m256 vthreshold = _mm256_set1_ps(conf.iou_threshold);
+    const __m256 vcand_valid = _mm256_cmp_ps(vareai, vzero, _CMP_GT_OQ);
+
+    for (; j + 8 <= end; j += 8) {
+        const __m256 vareaj = _mm256_loadu_ps(kept.area + j);
+        const __m256 vwidth = _mm256_sub_ps(_mm256_min_ps(vx1i, _mm256_loadu_ps(kept.x1 + j)),
+                                            _mm256_max_ps(vx0i, _mm256_loadu_ps(kept.x0 + j)));
+        const __m256 vheight = _mm256_sub_ps(_mm256_min_ps(vy1i, _mm256_loadu_ps(kept.y1 + j)),
+                                             _mm256_max_ps(vy0i, _mm256_loadu_ps(kept.y0 + j)));
+
+        __m256 vvalid = _mm256_and_ps(vcand_valid, _mm256_cmp_ps(vwidth, vzero, _CMP_GT_OQ));
+        vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vheight, vzero, _CMP_GT_OQ));
+        vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vareaj, vzero, _CMP_GT_OQ));
+
+        const __m256 vintersection = _mm256_mul_ps(vwidth, vheight);
+        const __m256 viou = _mm256_and_ps(vvalid,
+                _mm256_div_ps(vintersection, _mm256_sub_ps(_mm256_add_ps(vareai, vareaj), vintersection)));
+        if (ious)
+            _mm256_storeu_ps(ious + j, viou);
+
+        const __m256 vsuppressed = conf.suppress_equal_iou ? _mm256_cmp_ps(viou, vthreshold, _CMP_GE_OQ)
+                                                           : _mm256_cmp_ps(viou, vthreshold, _CMP_GT_OQ);
+        if (_mm256_movemask_ps(vsuppressed))
+            return true;
+    }
+#endif
+
+    for (; j < end; j++) {
+        const float iou = intersection_over_union(x0i, y0i, x1i, y1i, areai,
+                                                  kept.x0[j], kept.y0[j], kept.x1[j], kept.y1[j], kept.area[j]);
+        if (ious)
+            ious[j] = iou;
+        if (conf.suppress_equal_iou ? iou >= conf.iou_threshold : iou > conf.iou_threshold)
+            return true;
+    }
+    return false;
+}
+
+using candidate = std::pair<float, int>;
+
+void filter_by_score(const float* scores, int num_boxes, float score_threshold, std::vector<candidate>& candidates) {
+    int i = 0;
+
+#if defined(HAVE_AVX512F)
+    const __m512 vthreshold = _mm512_set1_ps(score_threshold);
+    for (; i + 16 <= num_boxes; i += 16) {
+        __mmask16 vmask = _mm512_cmp_ps_mask(_mm512_loadu_ps(scores + i), vthreshold, _CMP_GT_OQ);
+        for (int k = 0; vmask; k++, vmask >>= 1) {
+            if (vmask & 1)
+                candidates.emplace_back(scores[i + k], i + k);
+        }
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vthreshold = _mm256_set1_ps(score_threshold);
+    for (; i + 8 <= num_boxes; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), vthreshold, _CMP_GT_OQ));
+        for (int k = 0; mask; k++, mask >>= 1) {
+            if (mask & 1)
+                candidates.emplace_back(scores[i + k], i + k);
+        }
+    }
+#endif
+
+    for (; i < num_boxes; i++) {
+        if (scores[i] > score_threshold)
+            candidates.emplace_back(scores[i], i);
+    }
+}
+
+size_t nms_hard(const std::vector<candidate>& candidates, const nms_boxes& boxes, const nms_conf& conf, nms_scratch& scratch,
+                float* out_scores, int* out_indices) {
+    const size_t max_out = (std::min)(conf.max_output_boxes, candidates.size());
+    kept_boxes kept(scratch.kept, max_out);
+
+    for (size_t i = 0; i < candidates.size() && kept.size < max_out; i++) {
+        const int idx = candidates[i].second;
+        if (!is_suppressed(kept, 0, kept.size, boxes, idx, conf, nullptr)) {
+            if (out_scores)
+                out_scores[kept.size] = candidates[i].first;
+            out_indices[kept.size] = idx;
+            kept.push(boxes, idx);
+        }
+    }
+    return kept.size;
+}
+
+size_t nms_soft(const std::vector<candidate>& candidates, const nms_boxes& boxes, const nms_conf& conf, nms_scratch& scratch,
+                float* out_scores, int* out_indices) {
+    struct box_info {
+        float score;
+        int idx;
+        size_t suppress_begin_index;
+    };
+    auto less = [](const box_info& l, const box_info& r) {
+        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
+    };
+
+    std::vector<box_info> heap_storage;
+    heap_storage.reserve(candidates.size());
+    for (const auto& c : candidates)
+        heap_storage.push_back({c.first, c.second, 0});
+    std::priority_queue<box_info, std::vector<box_info>, decltype(less)> sorted_boxes(less, std::move(heap_storage));
+
+    const size_t max_out = (std::min)(conf.max_output_boxes, candidates.size());
+    kept_boxes kept(scratch.kept, max_out);
+    if (scratch.ious.size() < max_out)
+        scratch.ious.resize(max_out);
+    float* ious = scratch.ious.data();
+
+    while (kept.size < max_out && !sorted_boxes.empty()) {
+        box_info curr_box = sorted_boxes.top();
+        const float orig_score = curr_box.score;
+        sorted_boxes.pop();
+
+        if (is_suppressed(kept, curr_box.suppress_begin_index, kept.size, boxes, curr_box.idx, conf, ious))
+            continue;
+
+        // the newest kept boxes are applied first, as in the reference implementation
+        for (size_t j = kept.size; j > curr_box.suppress_begin_index; j--) {
+            const float iou = ious[j - 1];
+            curr_box.score *= std::exp(conf.soft_nms_scale * iou * iou);
+            if (curr_box.score <= conf.score_threshold)
+                break;
+        }
+
+        curr_box.suppress_begin_index = kept.size;
+        if (curr_box.score == orig_score) {
+            if (out_scores)
+                out_scores[kept.size] = curr_box.score;
+            out_indices[kept.size] = curr_box.idx;
+            kept.push(boxes, curr_box.idx);
+        } else if (curr_box.score > conf.score_threshold) {
+            sorted_boxes.push(curr_box);
+        }
+    }
+    return kept.size;
+}
+
+}  // namespace
+
+void nms_exec(const float* scores, int num_boxes, nms_boxes& boxes, nms_conf& conf, nms_scratch& scratch,
+              float* out_scores, int* out_indices, size_t& num_selected) {
+    num_selected = 0;
+    if (conf.max_output_boxes == 0 || num_boxes <= 0)
+        return;
+
+    std::vector<candidate>& candidates = scratch.candidates;
+    candidates.clear();
+    candidates.reserve(num_boxes);
+    filter_by_score(scores, num_boxes, conf.score_threshold, candidates);
+    if (candidates.empty())
+        return;
+
+    // need more particular comparator to get deterministic behaviour for boxes with the same score
+    auto greater = [](const candidate& l, const candidate& r) {
+        return l.first > r.first || ((l.first == r.first) && (l.second < r.second));
+    };
+
+    if (conf.top_k > -1 && static_cast<size_t>(conf.top_k) < candidates.size()) {
+        // only the best top_k candidates are ordered, the rest are dropped unsorted
+        std::partial_sort(candidates.begin(), candidates.begin() + conf.top_k, candidates.end(), greater);
+        candidates.resize(conf.top_k);
+    } else if (conf.soft_nms_scale == 0.0f) {
+        if (candidates.size() >= parallel_sort_threshold)
+            parallel_sort(candidates.begin(), candidates.end(), greater);
+        else
+            std::sort(candidates.begin(), candidates.end(), greater);
+    }
+
+    if (conf.soft_nms_scale == 0.0f)
+        num_selected = nms_hard(candidates, boxes, conf, scratch, out_scores, out_indices);
+    else
+        num_selected = nms_soft(candidates, boxes, conf, scratch, out_scores, out_indices);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes of a single image in the planar (SoA) corner format with precomputed areas.
+// The order of axes doesn't matter for IoU, so both (y, x) and (x, y) encoded boxes are accepted.
+struct nms_boxes {
+    const float* x0;
+    const float* y0;
+    const float* x1;
+    const float* y1;
+    const float* area;
+};
+
+struct nms_conf {
+    float score_threshold;       // boxes with score <= score_threshold are ignored
+    float iou_threshold;
+    bool suppress_equal_iou;     // suppress if IoU >= iou_threshold (otherwise only if IoU > iou_threshold)
+    float soft_nms_scale;        // -0.5 / sigma for soft-NMS, 0 means hard NMS
+    int top_k;                   // number of best candidates passed to NMS, -1 means all
+    size_t max_output_boxes;
+};
+
+// Buffers reused between calls, so steady-state execution doesn't allocate memory.
+// One instance per thread (or per concurrently processed (batch, class) pair) is required.
+struct nms_scratch {
+    std::vector<std::pair<float, int>> candidates;
+    std::vector<float> kept;
+    std::vector<float> ious;
+};
+
+namespace XARCH {
+
+// Selected boxes are written to 'out_indices' (and 'out_scores' if it isn't null) in the order of selection.
+void nms_exec(const float* scores, int num_boxes, nms_boxes& boxes, nms_conf& conf, nms_scratch& scratch,
+              float* out_scores, int* out_indices, size_t& num_selected);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "nms_imp.hpp"
 
 #include <cmath>
 #include <string>
@@ -10,7 +11,6 @@
 #include <cassert>
 #include <algorithm>
 #include <utility>
-#include <queue>
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
@@ -77,6 +77,8 @@ public:
             if (num_boxes != scores_dims[2])
                 IE_THROW() << logPrefix << " num_boxes is different in 'boxes' and 'scores' inputs";
 
+            decodedBoxes.resize(num_batches * 5 * num_boxes);
+
             numFiltBox.resize(num_batches);
             for (size_t i = 0; i < numFiltBox.size(); i++)
                 numFiltBox[i].resize(num_classes);
@@ -143,41 +145,6 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (boxEncodingType == boxEncoding::CENTER) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
-    }
-
     struct filteredBoxes {
         float score;
         int batch_index;
@@ -188,112 +155,71 @@ public:
                       score(_score), batch_index(_batch_index), class_index(_class_index), box_index(_box_index) {}
     };
 
-    struct boxInfo {
-        float score;
-        int idx;
-        int suppress_begin_index;
-    };
-
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                          std::vector<filteredBoxes> &filtBoxes) {
-        auto less = [](const boxInfo& l, const boxInfo& r) {
-            return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-        };
-
-        auto coeff = [&](float iou) {
-            const float weight = std::exp(scale * iou * iou);
-            return iou <= iou_threshold ? weight : 0.0f;
-        };
-
-        parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            std::vector<filteredBoxes> fb;
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-            const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+    // Converts boxes to the planar corner format (ymin, xmin, ymax, xmax, area) once per batch,
+    // so IoU for a candidate can be computed against all kept boxes of any class in SIMD lanes
+    void decodeBoxes(const float *boxes, const SizeVector &boxesStrides) {
+        parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+            const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+            float *planes = decodedBoxes.data() + batch_idx * 5 * num_boxes;
+
+            float ymin, xmin, ymax, xmax;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                ymin = box[1] - box[3] / 2.f;
+                xmin = box[0] - box[2] / 2.f;
+                ymax = box[1] + box[3] / 2.f;
+                xmax = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                ymin = (std::min)(box[0], box[2]);
+                xmin = (std::min)(box[1], box[3]);
+                ymax = (std::max)(box[0], box[2]);
+                xmax = (std::max)(box[1], box[3]);
             }
 
-            fb.reserve(sorted_boxes.size());
-            if (sorted_boxes.size() > 0) {
-                while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
-                        currBox.score *= coeff(iou);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= score_threshold)
-                            break;
-                    }
-
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (currBox.score == origScore) {
-                            fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
-                            continue;
-                        }
-                        if (currBox.score > score_threshold) {
-                            sorted_boxes.push(currBox);
-                        }
-                    }
-                }
-            }
-            numFiltBox[batch_idx][class_idx] = fb.size();
-            size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            for (size_t i = 0; i < fb.size(); i++) {
-                filtBoxes[offset + i] = fb[i];
-            }
+            planes[0 * num_boxes + box_idx] = ymin;
+            planes[1 * num_boxes + box_idx] = xmin;
+            planes[2 * num_boxes + box_idx] = ymax;
+            planes[3 * num_boxes + box_idx] = xmax;
+            planes[4 * num_boxes + box_idx] = (ymax - ymin) * (xmax - xmin);
         });
     }
 
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                             std::vector<filteredBoxes> &filtBoxes) {
-        int max_out_box = static_cast<int>(max_output_boxes_per_class);
-        parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-            const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
-            std::vector<std::pair<float, int>> sorted_boxes;
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+    void nms(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+        nms_conf conf;
+        conf.score_threshold = score_threshold;
+        conf.iou_threshold = iou_threshold;
+        conf.suppress_equal_iou = true;
+        conf.soft_nms_scale = scale;
+        conf.top_k = -1;
+        conf.max_output_boxes = max_output_boxes_per_class;
+
+        const int maxThreads = parallel_get_max_threads();
+        if (threadBuffers.size() < static_cast<size_t>(maxThreads))
+            threadBuffers.resize(maxThreads);
+
+        parallel_nt(maxThreads, [&](const int ithr, const int nthr) {
+            threadBuffer &buffer = threadBuffers[ithr];
+            if (buffer.selectedScores.size() < max_output_boxes_per_class) {
+                buffer.selectedScores.resize(max_output_boxes_per_class);
+                buffer.selectedIndices.resize(max_output_boxes_per_class);
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+            for_2d(ithr, nthr, num_batches, num_classes, [&](size_t batch_idx, size_t class_idx) {
+                const float *planes = decodedBoxes.data() + batch_idx * 5 * num_boxes;
+                nms_boxes boxes = {planes, planes + num_boxes, planes + 2 * num_boxes, planes + 3 * num_boxes, planes + 4 * num_boxes};
+                const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+
+                size_t selected = 0;
+                XARCH::nms_exec(scoresPtr, static_cast<int>(num_boxes), boxes, conf, buffer.scratch,
+                                buffer.selectedScores.data(), buffer.selectedIndices.data(), selected);
+
+                numFiltBox[batch_idx][class_idx] = selected;
+                size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+                for (size_t i = 0; i < selected; i++) {
+                    filtBoxes[offset + i] = filteredBoxes(buffer.selectedScores[i], batch_idx, class_idx, buffer.selectedIndices[i]);
                 }
-            }
-            numFiltBox[batch_idx][class_idx] = io_selection_size;
+            });
         });
     }
 
@@ -309,6 +235,7 @@ public:
 
         if (max_output_boxes_per_class == 0)
             return OK;
+        max_output_boxes_per_class = (std::min)(max_output_boxes_per_class, num_boxes);
 
         iou_threshold = outputs.size() > NMS_SELECTEDSCORES ? 0.0f : 1.0f;
         if (inputs.size() > NMS_IOUTHRESHOLD)
@@ -347,11 +274,8 @@ public:
 
         std::vector<filteredBoxes> filtBoxes(max_output_boxes_per_class * num_batches * num_classes);
 
-        if (soft_nms_sigma == 0.0f) {
-            nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
-        } else {
-            nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
-        }
+        decodeBoxes(boxes, boxesStrides);
+        nms(scores, scoresStrides, filtBoxes);
 
         size_t startOffset = numFiltBox[0][0];
         for (size_t b = 0; b < numFiltBox.size(); b++) {
@@ -439,7 +363,17 @@ private:
     float soft_nms_sigma = 0.0f;
     float scale = 1.f;
 
+    std::vector<float> decodedBoxes;
     std::vector<std::vector<size_t>> numFiltBox;
+
+    // NMS buffers of a thread, they are kept between calls
+    struct threadBuffer {
+        nms_scratch scratch;
+        std::vector<float> selectedScores;
+        std::vector<int> selectedIndices;
+    };
+    std::vector<threadBuffer> threadBuffers;
+
     const std::string inType = "input", outType = "output";
     std::string logPrefix;
 
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+
+namespace MKLDNNPlugin {
+
+int PerfCount::bucket(uint64_t ns) {
+    if (ns < kSubBuckets)
+        return static_cast<int>(ns);
+
+    int msb = 63;
+    while (!(ns >> msb))
+        msb--;
+    // bucket = octave * kSubBuckets + the next kSubBucketsLog2 bits after the most significant one
+    const int shift = msb - kSubBucketsLog2;
+    const int sub = static_cast<int>((ns >> shift) & (kSubBuckets - 1));
+    return (shift + 1) * kSubBuckets + sub;
+}
+
+uint64_t PerfCount::bucketLow(int bucket) {
+    if (bucket < kSubBuckets)
+        return static_cast<uint64_t>(bucket);
+
+    const int shift = bucket / kSubBuckets - 1;
+    return (static_cast<uint64_t>(kSubBuckets + bucket % kSubBuckets)) << shift;
+}
+
+uint64_t PerfCount::percentile_ns(double p) const {
+    if (num == 0)
+        return 0;
+
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(p * num + 0.5));
+    uint64_t seen = 0;
+    for (int b = 0; b < kBuckets; b++) {
+        seen += histogram[b];
+        if (seen < rank)
+            continue;
+
+        if (b < kSubBuckets)
+            return static_cast<uint64_t>(b);
+        // middle of the bucket range, but not above the observed maximum
+        const int shift = b / kSubBuckets - 1;
+        const uint64_t mid = bucketLow(b) + ((1ull << shift) >> 1);
+        return std::min(mid, maxDuration);
+    }
+    return maxDuration;
+}
+
+}  // namespace MKLDNNPlugin
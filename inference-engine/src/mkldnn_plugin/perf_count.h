@@ -4,32 +4,71 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Execution time statistics of a node: average and log-bucketed histogram of durations
+ * to estimate percentiles. Each octave of durations is split into kSubBuckets buckets,
+ * so the relative error of a percentile is below 1 / kSubBuckets.
+ *
+ * Durations are measured by steady_clock in nanoseconds, so no calibration is needed.
+ *
+ * Isn't thread safe, every stream has its own graph copy
+ */
 class PerfCount {
-    uint64_t duration;
-    uint32_t num;
+public:
+    static const int kSubBucketsLog2 = 3;
+    static const int kSubBuckets = 1 << kSubBucketsLog2;
+    static const int kBuckets = 64 * kSubBuckets;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    PerfCount(): duration(0), maxDuration(0), num(0), histogram() {}
 
-public:
-    PerfCount(): duration(0), num(0) {}
+    // average in microseconds
+    uint64_t avg() const { return avg_ns() / 1000; }
+
+    uint64_t avg_ns() const { return (num == 0) ? 0 : duration / num; }
+
+    uint64_t max_ns() const { return maxDuration; }
+
+    // percentile in nanoseconds, p is in [0, 1]
+    uint64_t percentile_ns(double p) const;
+
+    uint32_t count() const { return num; }
+
+    // accounts one execution of the given duration
+    void add(uint64_t ns) {
+        duration += ns;
+        if (ns > maxDuration)
+            maxDuration = ns;
+        histogram[bucket(ns)]++;
+        num++;
+    }
+
+    // index of the histogram bucket for the duration
+    static int bucket(uint64_t ns);
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // the smallest duration which falls into the bucket
+    static uint64_t bucketLow(int bucket);
 
 private:
+    uint64_t duration;
+    uint64_t maxDuration;
+    uint32_t num;
+    std::array<uint32_t, kBuckets> histogram;
+
+    std::chrono::steady_clock::time_point __start = {};
+
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = std::chrono::steady_clock::now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
-        num++;
+        const auto elapsed = std::chrono::steady_clock::now() - __start;
+        add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
     }
 
     friend class PerfHelper;
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Work which is executed exactly once: either by a background worker or by the first
+ * consumer which needs its result, whichever comes first. Other callers wait for completion.
+ *
+ * Is a thread safe
+ */
+class DeferredTask {
+public:
+    typedef std::shared_ptr<DeferredTask> Ptr;
+
+    /**
+     * A task which is not cancellable is shared by several owners (e.g. it fills an entry of the weights cache),
+     * so one owner must not prevent it from being executed for the others.
+     */
+    explicit DeferredTask(std::function<void()> task, bool cancellable = true)
+        : cancellable(cancellable), task(std::move(task)) {}
+
+    /**
+     * Runs the task in the calling thread if it hasn't been started yet, otherwise waits until it is completed.
+     * If the task throws, the exception is propagated and the next call retries the task.
+     */
+    void run() {
+        // std::call_once is not used, as it does not allow a retry after an exception with libstdc++
+        std::lock_guard<std::mutex> lock(guard);
+        if (done)
+            return;
+        if (!cancelled)
+            task();
+        done = true;
+        task = nullptr;
+    }
+
+    /**
+     * Prevents the task from being executed in future. Waits for completion if the task is being executed right now.
+     * Does nothing for a task which is not cancellable.
+     */
+    void cancel() {
+        if (!cancellable)
+            return;
+        cancelled = true;
+        run();
+    }
+
+private:
+    const bool cancellable;
+    std::mutex guard;
+    bool done = false;
+    std::atomic<bool> cancelled{false};
+    std::function<void()> task;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// opened groups of all threads
+std::mutex groupsGuard;
+std::vector<const HwPerfCounters*> groups;
+
+}  // namespace
+
+#ifdef __linux__
+
+namespace {
+
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+// in the HwCounter order
+const EventConfig events[HwCountersNum] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                         (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+};
+
+int openEvent(const EventConfig& event, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // the calling thread only, on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+}  // namespace
+
+HwPerfCounters::HwPerfCounters() {
+    fds.fill(-1);
+    index.fill(-1);
+
+    // cycles lead the group, so the other counters are scheduled only together with them
+    for (size_t i = 0; i < HwCountersNum; i++) {
+        const int fd = openEvent(events[i], leader);
+        if (fd < 0) {
+            if (leader < 0)
+                return;
+            continue;
+        }
+        if (leader < 0)
+            leader = fd;
+        fds[i] = fd;
+        index[i] = static_cast<int>(opened++);
+    }
+
+    std::lock_guard<std::mutex> lock(groupsGuard);
+    groups.push_back(this);
+}
+
+HwPerfCounters::~HwPerfCounters() {
+    if (leader >= 0) {
+        std::lock_guard<std::mutex> lock(groupsGuard);
+        groups.erase(std::find(groups.begin(), groups.end(), this));
+    }
+    for (int fd : fds) {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+bool HwPerfCounters::read(HwCounterValues& values) const {
+    values.fill(0);
+    if (leader < 0)
+        return false;
+
+    // nr, time_enabled, time_running, values[nr]
+    uint64_t data[3 + HwCountersNum];
+    const ssize_t expected = static_cast<ssize_t>((3 + opened) * sizeof(uint64_t));
+    if (::read(leader, data, sizeof(data)) < expected || data[0] != opened)
+        return false;
+
+    // the group may be multiplexed with other users of the PMU, the values are extrapolated then
+    const double scale = (data[2] != 0 && data[2] < data[1]) ? static_cast<double>(data[1]) / data[2] : 1.0;
+    for (size_t i = 0; i < HwCountersNum; i++) {
+        if (index[i] >= 0)
+            values[i] = static_cast<uint64_t>(data[3 + index[i]] * scale);
+    }
+    return true;
+}
+
+#else
+
+HwPerfCounters::HwPerfCounters() {
+    fds.fill(-1);
+    index.fill(-1);
+}
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+bool HwPerfCounters::read(HwCounterValues& values) const {
+    values.fill(0);
+    return false;
+}
+
+#endif  // __linux__
+
+const HwPerfCounters& HwPerfCounters::forCurrentThread() {
+    static thread_local HwPerfCounters counters;
+    return counters;
+}
+
+void HwPerfCounters::readAll(HwCounterValues& values) {
+    values.fill(0);
+    std::lock_guard<std::mutex> lock(groupsGuard);
+    for (auto group : groups) {
+        HwCounterValues groupValues;
+        if (!group->read(groupValues))
+            continue;
+        for (size_t i = 0; i < HwCountersNum; i++)
+            values[i] += groupValues[i];
+    }
+}
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+namespace {
+
+// Workers already running when the observer is created are notified when they enter the scheduler again
+class WorkersObserver : public tbb::task_scheduler_observer {
+public:
+    WorkersObserver() { observe(true); }
+    void on_scheduler_entry(bool) override {
+        HwPerfCounters::forCurrentThread();
+    }
+};
+
+}  // namespace
+#endif
+
+void HwPerfCounters::observeWorkers() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        // never destroyed, as workers may enter the scheduler until the process exit
+        new WorkersObserver();
+#endif
+        // OpenMP threads are persistent, so they open the groups once
+        InferenceEngine::parallel_nt(parallel_get_max_threads(), [](const int, const int) {
+            HwPerfCounters::forCurrentThread();
+        });
+    });
+}
+
+HwPerfHelper::HwPerfHelper(HwPerfCount* count) : counter(count) {
+    if (!counter)
+        return;
+    group = &HwPerfCounters::forCurrentThread();
+    if (!group->read(start)) {
+        counter = nullptr;
+        return;
+    }
+    HwPerfCounters::observeWorkers();
+    HwPerfCounters::readAll(start);
+}
+
+HwPerfHelper::~HwPerfHelper() {
+    if (!counter)
+        return;
+
+    HwCounterValues finish;
+    HwPerfCounters::readAll(finish);
+    for (size_t i = 0; i < HwCountersNum; i++) {
+        const auto id = static_cast<HwCounter>(i);
+        counter->available[i] = group->isAvailable(id);
+        if (finish[i] > start[i])
+            counter->totals[i] += finish[i] - start[i];
+    }
+    counter->num++;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+enum class HwCounter {
+    Cycles,
+    Instructions,
+    LlcMisses,
+    BackendStalls,      // cycles stalled in the backend, which are mostly memory-bound stalls
+};
+
+static constexpr size_t HwCountersNum = 4;
+
+using HwCounterValues = std::array<uint64_t, HwCountersNum>;
+
+/**
+ * Group of hardware counters (Linux perf_event_open) of the current thread.
+ * The counters which aren't supported by the CPU or aren't permitted (see perf_event_paranoid) are unavailable.
+ * Only user space events of the thread itself are counted: the counters are not inherited, as inheritance
+ * covers only threads created after the group is opened (not the already running TBB workers) and can't be
+ * combined with reading the whole group at once. Instead, every thread of the parallel runtime opens its own group
+ * (see observeWorkers) and the groups of all threads are summed up by readAll.
+ */
+class HwPerfCounters {
+public:
+    // The group is opened on the first call in the thread and closed on the thread exit
+    static const HwPerfCounters& forCurrentThread();
+
+    // Opens groups in the worker threads of the parallel runtime as they start executing tasks. Called once.
+    static void observeWorkers();
+
+    bool isAvailable(HwCounter counter) const { return index[static_cast<size_t>(counter)] >= 0; }
+
+    // Reads the current values of all counters, unavailable ones are zero. Returns false on failure.
+    bool read(HwCounterValues& values) const;
+
+    // Sums up the current values of the groups of all threads, which have one opened
+    static void readAll(HwCounterValues& values);
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+private:
+    HwPerfCounters();
+    ~HwPerfCounters();
+
+    int leader = -1;
+    std::array<int, HwCountersNum> fds;
+    std::array<int, HwCountersNum> index;   // position in the group read format or -1
+    size_t opened = 0;
+};
+
+/**
+ * Hardware counters accumulated over executions of a node, including the work the node distributes to the workers
+ * of the parallel runtime. The workers are shared by all streams, so the work of nodes which other streams execute
+ * at the same time is counted as well.
+ */
+class HwPerfCount {
+public:
+    uint32_t count() const { return num; }
+
+    bool isAvailable(HwCounter counter) const { return available[static_cast<size_t>(counter)]; }
+
+    // average value per execution
+    uint64_t avg(HwCounter counter) const {
+        return num == 0 ? 0 : totals[static_cast<size_t>(counter)] / num;
+    }
+
+private:
+    HwCounterValues totals = {};
+    std::array<bool, HwCountersNum> available = {};
+    uint32_t num = 0;
+
+    friend class HwPerfHelper;
+};
+
+/**
+ * Adds the counter deltas of all threads over the scope to the node statistics. Does nothing if the statistics
+ * isn't specified or the counters of the current thread are unavailable.
+ */
+class HwPerfHelper {
+public:
+    explicit HwPerfHelper(HwPerfCount* count);
+    ~HwPerfHelper();
+
+private:
+    HwPerfCount* counter;
+    const HwPerfCounters* group = nullptr;     // availability of the counters is the same for all threads
+    HwCounterValues start = {};
+};
+
+}  // namespace MKLDNNPlugin
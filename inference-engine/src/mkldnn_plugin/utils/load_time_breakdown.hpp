@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Durations of network loading phases in milliseconds, reported by CPU_LOAD_TIME_BREAKDOWN metric.
+ * Graphs of all streams add their phases, so graph phases are summed over the streams.
+ *
+ * Is a thread safe
+ */
+class LoadTimeBreakdown {
+public:
+    typedef std::shared_ptr<LoadTimeBreakdown> Ptr;
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Adds time elapsed from construction till destruction to the phase. Does nothing for nullptr breakdown.
+     */
+    class Scope {
+    public:
+        Scope(LoadTimeBreakdown* breakdown, const char* phase) : breakdown(breakdown), phase(phase) {
+            if (breakdown)
+                start = Clock::now();
+        }
+
+        ~Scope() {
+            if (breakdown)
+                breakdown->add(phase, Clock::now() - start);
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        LoadTimeBreakdown* breakdown;
+        const char* phase;
+        Clock::time_point start;
+    };
+
+    void add(const std::string& phase, Clock::duration duration) {
+        std::lock_guard<std::mutex> lock(guard);
+        phases[phase] += std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    std::map<std::string, double> get() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return phases;
+    }
+
+private:
+    mutable std::mutex guard;
+    std::map<std::string, double> phases;
+};
+
+}  // namespace MKLDNNPlugin
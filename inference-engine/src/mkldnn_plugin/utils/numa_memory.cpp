@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#include <ie_common.h>
+#include <ie_system_conf.h>
+
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Memory policies are applied per page, so small buffers are not worth separate pages
+const size_t kMinPlacedSize = 64 * 1024;
+const size_t kAlignment = 64;
+
+std::mutex usageGuard;
+std::map<int, uint64_t> usage;
+
+std::mutex topologyGuard;
+NumaTopology::Ptr topology;
+
+std::vector<std::pair<int, uint64_t>> distribute(size_t size, const NumaPlacement& placement,
+                                                 const std::vector<int>& nodes) {
+    if (placement.policy != NumaPolicy::Interleave)
+        return {{placement.node, size}};
+
+    std::vector<std::pair<int, uint64_t>> parts;
+    for (size_t i = 0; i < nodes.size(); i++)
+        parts.emplace_back(nodes[i], size / nodes.size() + (i < size % nodes.size() ? 1 : 0));
+    return parts;
+}
+
+void account(const std::vector<std::pair<int, uint64_t>>& parts, bool allocated) {
+    std::lock_guard<std::mutex> lock(usageGuard);
+    for (const auto& part : parts) {
+        if (allocated)
+            usage[part.first] += part.second;
+        else
+            usage[part.first] -= part.second;
+    }
+}
+
+#if defined(__linux__) && defined(__NR_mbind)
+const int MPOL_BIND_MODE = 2;
+const int MPOL_INTERLEAVE_MODE = 3;
+#endif
+
+}  // namespace
+
+std::vector<int> NumaTopology::nodes() const {
+    return InferenceEngine::getAvailableNUMANodes();
+}
+
+void NumaTopology::bind(void* ptr, size_t size, NumaPolicy policy, const std::vector<int>& nodes) const {
+#if defined(__linux__) && defined(__NR_mbind)
+    const size_t bitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+    std::vector<unsigned long> mask;  // NOLINT
+    for (auto node : nodes) {
+        if (node < 0)
+            continue;
+        const size_t word = static_cast<size_t>(node) / bitsPerWord;
+        if (mask.size() <= word)
+            mask.resize(word + 1, 0);
+        mask[word] |= 1ul << (static_cast<size_t>(node) % bitsPerWord);
+    }
+    if (mask.empty())
+        return;
+
+    // failure (e.g. the policy is not permitted in a container) just leaves the default placement
+    syscall(__NR_mbind, ptr, size,
+            policy == NumaPolicy::Bind ? MPOL_BIND_MODE : MPOL_INTERLEAVE_MODE,
+            mask.data(), mask.size() * bitsPerWord + 1, 0);
+#endif
+}
+
+NumaTopology::Ptr getNumaTopology() {
+    std::lock_guard<std::mutex> lock(topologyGuard);
+    if (!topology)
+        topology = std::make_shared<NumaTopology>();
+    return topology;
+}
+
+void setNumaTopology(const NumaTopology::Ptr& newTopology) {
+    std::lock_guard<std::mutex> lock(topologyGuard);
+    topology = newTopology;
+}
+
+std::shared_ptr<void> allocateNumaMemory(size_t size, const NumaPlacement& placement) {
+    if (size == 0)
+        size = 1;
+
+    const auto numaTopology = getNumaTopology();
+    const auto nodes = numaTopology->nodes();
+    const auto parts = distribute(size, placement, nodes);
+    void* ptr = nullptr;
+    std::function<void(void*)> release;
+
+#if defined(__linux__)
+    if (placement.policy != NumaPolicy::None && size >= kMinPlacedSize) {
+        // pages are not touched by mmap, so the policy set before the first write defines their placement
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            IE_THROW() << "Cannot allocate " << size << " bytes of memory";
+        numaTopology->bind(ptr, size, placement.policy,
+                           placement.policy == NumaPolicy::Bind ? std::vector<int>{placement.node} : nodes);
+        release = [size](void* p) { munmap(p, size); };
+    }
+#endif
+
+    if (ptr == nullptr) {
+        const size_t alignedSize = (size + kAlignment - 1) / kAlignment * kAlignment;
+#if defined(_WIN32)
+        ptr = _aligned_malloc(alignedSize, kAlignment);
+        release = [](void* p) { _aligned_free(p); };
+#else
+        if (posix_memalign(&ptr, kAlignment, alignedSize) != 0)
+            ptr = nullptr;
+        release = [](void* p) { free(p); };
+#endif
+        if (ptr == nullptr)
+            IE_THROW() << "Cannot allocate " << size << " bytes of memory";
+    }
+
+    account(parts, true);
+    return std::shared_ptr<void>(ptr, [parts, release](void* p) {
+        release(p);
+        account(parts, false);
+    });
+}
+
+std::map<int, uint64_t> getNumaMemoryUsage() {
+    std::lock_guard<std::mutex> lock(usageGuard);
+    return usage;
+}
+
+}  // namespace MKLDNNPlugin
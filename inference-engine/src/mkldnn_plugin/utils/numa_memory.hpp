@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+enum class NumaPolicy {
+    None,           // pages are placed by the OS (first touch)
+    Bind,           // pages are allocated on the specified node only
+    Interleave,     // pages are spread round-robin over all available nodes
+};
+
+struct NumaPlacement {
+    NumaPolicy policy = NumaPolicy::None;
+    int node = 0;   // target node for Bind, the node the memory is accounted to for None
+};
+
+/**
+ * NUMA topology of the system and the memory policy call used to place the pages.
+ * A fake topology can be set by tests (see setNumaTopology).
+ */
+class NumaTopology {
+public:
+    typedef std::shared_ptr<NumaTopology> Ptr;
+
+    virtual ~NumaTopology() = default;
+
+    // Ids of the available NUMA nodes
+    virtual std::vector<int> nodes() const;
+
+    // Applies the policy to the pages of not yet touched memory, the pages are allowed on the given nodes only
+    virtual void bind(void* ptr, size_t size, NumaPolicy policy, const std::vector<int>& nodes) const;
+};
+
+/**
+ * Returns the topology used by allocateNumaMemory and the weights caches.
+ */
+NumaTopology::Ptr getNumaTopology();
+
+/**
+ * Replaces the topology, nullptr restores the topology of the system.
+ */
+void setNumaTopology(const NumaTopology::Ptr& topology);
+
+/**
+ * Allocates memory with the pages placed on NUMA nodes according to the placement.
+ * If the OS doesn't support memory policies (or rejects them) the memory is allocated as usual.
+ * The bytes are accounted per NUMA node (see getNumaMemoryUsage) until the memory is released.
+ */
+std::shared_ptr<void> allocateNumaMemory(size_t size, const NumaPlacement& placement);
+
+/**
+ * Returns the number of bytes allocated by allocateNumaMemory and not yet released per NUMA node.
+ * Interleaved memory is split between the nodes evenly.
+ */
+std::map<int, uint64_t> getNumaMemoryUsage();
+
+}  // namespace MKLDNNPlugin
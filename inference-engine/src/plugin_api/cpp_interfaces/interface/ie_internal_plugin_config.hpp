@@ -45,6 +45,48 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Defines whether the CPU plugin repacks constant weights in background after LoadNetwork returns (set value to YES)
+ *        instead of doing it synchronously. The first inference waits only for the weights of layers being executed.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAZY_WEIGHTS_REPACKING);
+
+/**
+ * @brief Defines whether the CPU plugin collects hardware counters (cycles, instructions, LLC misses, backend stalls)
+ *        per graph node using Linux perf_event_open (set value to YES). The counters are reported in the execution
+ *        graph runtime information. The counters of all threads of the parallel runtime are summed up, so the work
+ *        of parallel nodes is included, as well as the work of other streams which run at the same time.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
+/**
+ * @brief Defines NUMA placement of constant weights in the CPU plugin:
+ *        NO - the OS places pages (default), REPLICATE - a copy per NUMA node bound to the node,
+ *        INTERLEAVE - a single copy shared by all streams with pages interleaved over all nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(REPLICATE);
+DECLARE_CONFIG_VALUE(INTERLEAVE);
+
+/**
+ * @brief Metric of the CPU plugin to get std::map<int, uint64_t> with the number of bytes of constant weights
+ *        currently allocated on each NUMA node. The metric is internal, so it is not listed in SUPPORTED_METRICS
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_WEIGHTS_BYTES_PER_NUMA_NODE = "CPU_WEIGHTS_BYTES_PER_NUMA_NODE";
+
+/**
+ * @brief Metric of the CPU executable network to get std::map<std::string, double> with durations of
+ *        LoadNetwork phases in milliseconds (transformations, legacy conversion, graph optimization,
+ *        weights repacking, primitive creation, etc). Phases of the graphs are summed over streams.
+ *        The metric is internal, so it is not listed in SUPPORTED_METRICS
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_LOAD_TIME_BREAKDOWN = "CPU_LOAD_TIME_BREAKDOWN";
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -51,6 +51,73 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a median of execution times of the executable primitive in nanoseconds.
+ */
+static const char PERF_COUNTER_P50[] = "execTimeP50Ns";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get 90th percentile of execution times of the executable primitive in nanoseconds.
+ */
+static const char PERF_COUNTER_P90[] = "execTimeP90Ns";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get 99th percentile of execution times of the executable primitive in nanoseconds.
+ */
+static const char PERF_COUNTER_P99[] = "execTimeP99Ns";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a maximum execution time of the executable primitive in nanoseconds.
+ */
+static const char PERF_COUNTER_MAX[] = "execTimeMaxNs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of executions of the executable primitive.
+ */
+static const char PERF_COUNTER_NUM[] = "execCount";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an estimated number of bytes read by a single execution of the primitive.
+ */
+static const char BYTES_READ[] = "bytesRead";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an estimated number of bytes written by a single execution of the primitive.
+ */
+static const char BYTES_WRITTEN[] = "bytesWritten";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of CPU cycles per execution of the primitive (hardware counters).
+ * Hardware counters of all threads are summed up, so the work of parallel workers and of concurrently running streams is included.
+ */
+static const char HW_CYCLES[] = "hwCycles";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of retired instructions per execution of the primitive (hardware counters).
+ */
+static const char HW_INSTRUCTIONS[] = "hwInstructions";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of last level cache misses per execution of the primitive (hardware counters).
+ */
+static const char HW_LLC_MISSES[] = "hwLlcMisses";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of backend stall cycles per execution of the primitive (hardware counters).
+ */
+static const char HW_BACKEND_STALLS[] = "hwBackendStalls";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
@@ -84,6 +151,9 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
  * - ExecGraphInfoSerialization::PERF_COUNTER
+ * - ExecGraphInfoSerialization::PERF_COUNTER_P50, PERF_COUNTER_P90, PERF_COUNTER_P99, PERF_COUNTER_MAX, PERF_COUNTER_NUM (optional)
+ * - ExecGraphInfoSerialization::BYTES_READ, BYTES_WRITTEN (optional)
+ * - ExecGraphInfoSerialization::HW_CYCLES, HW_INSTRUCTIONS, HW_LLC_MISSES, HW_BACKEND_STALLS (optional)
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
@@ -105,6 +105,13 @@ void calculate_i420_to_rgb(const  uchar **srcY,
     calculate_i420_to_rgb_impl(srcY, srcU, srcV, dstRGBx, width);
 }
 
+void calculate_yuyv_to_rgb(const  uchar *src,
+                                  uchar *dstRGBx,
+                                    int width,
+                                   bool uyvy) {
+    calculate_yuyv_to_rgb_impl(src, dstRGBx, width, uyvy);
+}
+
 void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz,
                     const Size& outSz, Q0_16 yalpha, const MapperUnit8U &ymap,
                     int xmaxdf, const short xindex[], const Q0_16 xalpha[],
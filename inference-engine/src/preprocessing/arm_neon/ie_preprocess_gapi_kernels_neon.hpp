@@ -178,6 +178,11 @@ void calculate_i420_to_rgb(const  uchar **srcY,
                                   uchar **dstRGBx,
                                     int width);
 
+void calculate_yuyv_to_rgb(const  uchar *src,
+                                  uchar *dstRGBx,
+                                    int width,
+                                   bool uyvy);
+
 void copyRow_8U(const uint8_t in[],
                 uint8_t out[],
                 int length);
@@ -122,6 +122,13 @@ void calculate_i420_to_rgb(const  uchar **srcY,
     calculate_i420_to_rgb_impl(srcY, srcU, srcV, dstRGBx, width);
 }
 
+void calculate_yuyv_to_rgb(const  uchar *src,
+                                  uchar *dstRGBx,
+                                    int width,
+                                   bool uyvy) {
+    calculate_yuyv_to_rgb_impl(src, dstRGBx, width, uyvy);
+}
+
 void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz,
                     const Size& outSz, Q0_16 yalpha, const MapperUnit8U &ymap,
                     int xmaxdf, const short xindex[], const Q0_16 xalpha[],
@@ -574,6 +581,30 @@ void calcRowLinear_32F(float *dst[],
     calcRowLinear_32FC1(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
 }
 
+void calcRowCubic_8UC1(uint8_t*       dst[],
+                       const uint8_t* src[],
+                       const float    alpha[],
+                       const int      mapsx[],
+                       const float    beta[],
+                       float          vbuf[],
+                       const Size&    inSz,
+                       const Size&    outSz,
+                       int            lpi) {
+    calcRowCubic_impl(dst, src, alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+}
+
+void calcRowCubic_32F(float*       dst[],
+                      const float* src[],
+                      const float  alpha[],
+                      const int    mapsx[],
+                      const float  beta[],
+                      float        vbuf[],
+                      const Size&  inSz,
+                      const Size&  outSz,
+                      int          lpi) {
+    calcRowCubic_impl(dst, src, alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+}
+
 }  // namespace avx
 }  // namespace kernels
 }  // namespace gapi
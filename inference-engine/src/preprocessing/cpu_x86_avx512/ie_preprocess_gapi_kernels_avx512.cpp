@@ -656,6 +656,30 @@ void calcRowLinear_32F(float *dst[],
     calcRowLinear_32FC1(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
 }
 
+void calcRowCubic_8UC1(uint8_t*       dst[],
+                       const uint8_t* src[],
+                       const float    alpha[],
+                       const int      mapsx[],
+                       const float    beta[],
+                       float          vbuf[],
+                       const Size&    inSz,
+                       const Size&    outSz,
+                       int            lpi) {
+    calcRowCubic_impl(dst, src, alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+}
+
+void calcRowCubic_32F(float*       dst[],
+                      const float* src[],
+                      const float  alpha[],
+                      const int    mapsx[],
+                      const float  beta[],
+                      float        vbuf[],
+                      const Size&  inSz,
+                      const Size&  outSz,
+                      int          lpi) {
+    calcRowCubic_impl(dst, src, alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+}
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
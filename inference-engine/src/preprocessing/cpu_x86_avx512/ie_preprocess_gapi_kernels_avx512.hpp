@@ -107,6 +107,28 @@ void calcRowLinear_32F(float *dst[],
                        const Size & outSz,
                        int    lpi);
 
+// Resize (bi-cubic, 8UC1)
+void calcRowCubic_8UC1(uint8_t*       dst[],
+                       const uint8_t* src[],
+                       const float    alpha[],
+                       const int      mapsx[],
+                       const float    beta[],
+                       float          vbuf[],
+                       const Size&    inSz,
+                       const Size&    outSz,
+                       int            lpi);
+
+// Resize (bi-cubic, 32F)
+void calcRowCubic_32F(float*       dst[],
+                      const float* src[],
+                      const float  alpha[],
+                      const int    mapsx[],
+                      const float  beta[],
+                      float        vbuf[],
+                      const Size&  inSz,
+                      const Size&  outSz,
+                      int          lpi);
+
 //----------------------------------------------------------------------
 
 void mergeRow_8UC2(const uint8_t in0[],
@@ -106,6 +106,28 @@ void calcRowLinear_32F(float *dst[],
                  const Size & outSz,
                        int    lpi);
 
+// Resize (bi-cubic, 8UC1)
+void calcRowCubic_8UC1(uint8_t*       dst[],
+                       const uint8_t* src[],
+                       const float    alpha[],
+                       const int      mapsx[],
+                       const float    beta[],
+                       float          vbuf[],
+                       const Size&    inSz,
+                       const Size&    outSz,
+                       int            lpi);
+
+// Resize (bi-cubic, 32F)
+void calcRowCubic_32F(float*       dst[],
+                      const float* src[],
+                      const float  alpha[],
+                      const int    mapsx[],
+                      const float  beta[],
+                      float        vbuf[],
+                      const Size&  inSz,
+                      const Size&  outSz,
+                      int          lpi);
+
 //----------------------------------------------------------------------
 
 void mergeRow_8UC2(const uint8_t in0[],
@@ -191,6 +213,11 @@ void calculate_i420_to_rgb(const  uchar **srcY,
                                   uchar **dstRGBx,
                                     int width);
 
+void calculate_yuyv_to_rgb(const  uchar *src,
+                                  uchar *dstRGBx,
+                                    int width,
+                                   bool uyvy);
+
 void copyRow_8U(const uint8_t in[],
                 uint8_t out[],
                 int length);
@@ -11,6 +11,7 @@
 #include <ie_input_info.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -34,7 +35,8 @@ public:
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
 };
@@ -54,7 +56,7 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
@@ -66,11 +68,23 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
 
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
 
+    std::vector<float> mean, scale;
+    if (normalize) {
+        if (info.getMeanVariant() != MEAN_VALUE) {
+            IE_THROW() << "Input pre-processing normalization supports mean values only";
+        }
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            mean.push_back(info[c]->meanValue);
+            scale.push_back(info[c]->stdScale);
+        }
+    }
+
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, info.getResizeMode(), info.getPadValue(),
+                                 mean, scale, fmt, serial, batchSize);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
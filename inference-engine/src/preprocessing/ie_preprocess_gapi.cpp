@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <cmath>
+#include <limits>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -177,6 +179,23 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const I420Blob::Ptr& i
     return batched_input_plane_mats;
 }
 
+// a single blob is bound as is, otherwise the blobs are items of a batched blob: images of batch
+// size 1 with equal descriptors, each of them is bound as a separate batch element
+template<typename BlobTypePtr>
+std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const std::vector<BlobTypePtr>& blobs,
+                                                          int batch_size) {
+    if (blobs.size() == 1) {
+        return bind_to_blob(blobs.front(), batch_size);
+    }
+
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        batched_plane_mats[i] = std::move(bind_to_blob(blobs[i], 1)[0]);
+    }
+
+    return batched_plane_mats;
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -257,7 +276,10 @@ void validateColorFormats(const G::Desc &in_desc,
                 if (desc.d.C != 4) throw_invalid_number_of_channels();
                 break;
             }
-            case ColorFormat::NV12: {
+            case ColorFormat::NV12:
+            case ColorFormat::YUYV:
+            case ColorFormat::UYVY:
+            case ColorFormat::P010: {
                 if (desc.d.C != 2) throw_invalid_number_of_channels();
                 break;
             }
@@ -283,8 +305,10 @@ void validateColorFormats(const G::Desc &in_desc,
         IE_THROW() << "Network's expected color format is unspecified";
     }
 
-    if (output_color_format == ColorFormat::NV12 || output_color_format == ColorFormat::I420) {
-        IE_THROW() << "NV12/I420 network's color format is not supported [by G-API]";
+    if (output_color_format == ColorFormat::NV12 || output_color_format == ColorFormat::I420
+        || output_color_format == ColorFormat::YUYV || output_color_format == ColorFormat::UYVY
+        || output_color_format == ColorFormat::P010) {
+        IE_THROW() << "YUV network's color format is not supported [by G-API]";
     }
 
     verify_layout(in_layout, "Input blob");
@@ -308,6 +332,13 @@ void validateColorFormats(const G::Desc &in_desc,
                            << "instead (3 image planes instead of 4)";
     }
 
+    // packed YUV 4:2:2 is interleaved by its nature, the pixel pairs can't be split into planes
+    if (in_layout == NCHW
+        && (input_color_format == ColorFormat::YUYV || input_color_format == ColorFormat::UYVY)) {
+        IE_THROW() << "Input blob with NCHW layout and YUYV/UYVY color format is "
+                           << "not supported, NHWC layout is expected";
+    }
+
     // verify input and output against their corresponding color format
     verify_desc(in_desc, input_color_format, "Input blob");
     verify_desc(out_desc, output_color_format, "Network's blob");
@@ -357,6 +388,40 @@ void validateBlob(const I420Blob::Ptr &inBlob) {
     validateTensorDesc(v_blob->getTensorDesc());
 }
 
+// precisions, layouts and dimensions of the blob planes. strides are not included: they are
+// taken from the bound memory on every call, so ROIs of differently sized images are fine
+std::vector<std::tuple<Precision, Layout, SizeVector>> planesOf(const Blob::Ptr &blob) {
+    std::vector<Blob::Ptr> planes{blob};
+    if (auto compound = as<CompoundBlob>(blob)) {
+        planes.clear();
+        for (size_t i = 0; i < compound->size(); ++i) {
+            planes.push_back(compound->getBlob(i));
+        }
+    }
+
+    std::vector<std::tuple<Precision, Layout, SizeVector>> result;
+    for (const auto &plane : planes) {
+        if (!plane) {
+            IE_THROW() << "Invalid underlying blobs in " << (planes.size() > 1 ? "CompoundBlob" : "BatchedBlob");
+        }
+        const auto &desc = plane->getTensorDesc();
+        result.emplace_back(desc.getPrecision(), desc.getLayout(), desc.getDims());
+    }
+    return result;
+}
+
+// all items of a batched blob are processed by the graph compiled for the first one
+template<typename BlobTypePtr>
+void validateBatchItems(const std::vector<BlobTypePtr> &items) {
+    const auto first = planesOf(items.front());
+    for (size_t i = 1; i < items.size(); ++i) {
+        if (planesOf(items[i]) != first) {
+            IE_THROW() << "Items of BatchedBlob must have equal precisions, layouts and dimensions: item "
+                       << i << " differs from item 0";
+        }
+    }
+}
+
 const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const MemoryBlob::Ptr &blob) {
     const auto& desc =  blob->getTensorDesc();
     return {desc, desc.getLayout()};
@@ -469,6 +534,60 @@ class PlanarColorConversions {
         return planes;
     }
 
+    static std::vector<cv::GMat> P010toRGB(const std::vector<cv::GMat>& inputs,
+                                           Layout,
+                                           Layout,
+                                           ResizeAlgorithm) {
+        // in_layout is always NCHW
+        auto interleaved_rgb = gapi::P010toRGB::on(inputs[0], inputs[1]);
+        return split({interleaved_rgb}, 3);
+    }
+
+    static std::vector<cv::GMat> P010toBGR(const std::vector<cv::GMat>& inputs,
+                                           Layout in_layout,
+                                           Layout out_layout,
+                                           ResizeAlgorithm algorithm) {
+        auto planes = P010toRGB(inputs, in_layout, out_layout, algorithm);
+        std::reverse(planes.begin(), planes.end());
+        return planes;
+    }
+
+    static std::vector<cv::GMat> YUYVtoRGB(const std::vector<cv::GMat>& inputs,
+                                           Layout,
+                                           Layout,
+                                           ResizeAlgorithm) {
+        // in_layout is always NHWC
+        auto interleaved_rgb = gapi::YUYVtoRGB::on(inputs[0], false);
+        return split({interleaved_rgb}, 3);
+    }
+
+    static std::vector<cv::GMat> YUYVtoBGR(const std::vector<cv::GMat>& inputs,
+                                           Layout in_layout,
+                                           Layout out_layout,
+                                           ResizeAlgorithm algorithm) {
+        auto planes = YUYVtoRGB(inputs, in_layout, out_layout, algorithm);
+        std::reverse(planes.begin(), planes.end());
+        return planes;
+    }
+
+    static std::vector<cv::GMat> UYVYtoRGB(const std::vector<cv::GMat>& inputs,
+                                           Layout,
+                                           Layout,
+                                           ResizeAlgorithm) {
+        // in_layout is always NHWC
+        auto interleaved_rgb = gapi::YUYVtoRGB::on(inputs[0], true);
+        return split({interleaved_rgb}, 3);
+    }
+
+    static std::vector<cv::GMat> UYVYtoBGR(const std::vector<cv::GMat>& inputs,
+                                           Layout in_layout,
+                                           Layout out_layout,
+                                           ResizeAlgorithm algorithm) {
+        auto planes = UYVYtoRGB(inputs, in_layout, out_layout, algorithm);
+        std::reverse(planes.begin(), planes.end());
+        return planes;
+    }
+
     static std::vector<cv::GMat> I420toRGB(const std::vector<cv::GMat>& inputs,
                                            Layout,
                                            Layout,
@@ -499,7 +618,13 @@ public:
             { {ColorFormat::NV12, ColorFormat::BGR}, NV12toBGR },
             { {ColorFormat::NV12, ColorFormat::RGB}, NV12toRGB },
             { {ColorFormat::I420, ColorFormat::BGR}, I420toBGR },
-            { {ColorFormat::I420, ColorFormat::RGB}, I420toRGB }
+            { {ColorFormat::I420, ColorFormat::RGB}, I420toRGB },
+            { {ColorFormat::P010, ColorFormat::BGR}, P010toBGR },
+            { {ColorFormat::P010, ColorFormat::RGB}, P010toRGB },
+            { {ColorFormat::YUYV, ColorFormat::BGR}, YUYVtoBGR },
+            { {ColorFormat::YUYV, ColorFormat::RGB}, YUYVtoRGB },
+            { {ColorFormat::UYVY, ColorFormat::BGR}, UYVYtoBGR },
+            { {ColorFormat::UYVY, ColorFormat::RGB}, UYVYtoRGB }
         };
     }
 
@@ -551,7 +676,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const std::vector<float> &mean,
+                            const std::vector<float> &scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -564,24 +691,29 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     }
 
     // specific pre-processing case:
-    // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
+    // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for YUV input)
     // 2. Supports bilinear resize only
-    // 3. Supports NV12/I420 -> RGB/BGR color transformations
+    // 3. Supports NV12/I420/P010/YUYV/UYVY -> RGB/BGR color transformations
     const bool nv12_input = (input_color_format == ColorFormat::NV12);
     const bool i420_input = (input_color_format == ColorFormat::I420);
-    const bool specific_yuv420_input_handling = (nv12_input || i420_input)
+    const bool p010_input = (input_color_format == ColorFormat::P010);
+    const bool yuyv_input = (input_color_format == ColorFormat::YUYV);
+    const bool uyvy_input = (input_color_format == ColorFormat::UYVY);
+    const bool specific_yuv_input_handling = (nv12_input || i420_input || p010_input || yuyv_input || uyvy_input)
         && (output_color_format == ColorFormat::RGB || output_color_format == ColorFormat::BGR);
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
-    const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
-                                        && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+    // P010 samples are converted to 8-bit RGB by color conversion, so the rest of the graph works with U8
+    const int in_prec = p010_input ? CV_8U : in_desc.prec;
+    const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv_input_handling)
+                                        && (in_desc.d.C == 3 || specific_yuv_input_handling || drop_channel)
+                                        && ((in_prec == CV_8U) && (in_prec == out_desc.prec))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
                                             || drop_channel
-                                            || specific_yuv420_input_handling));
+                                            || specific_yuv_input_handling));
     if (specific_case_of_preproc) {
         const auto input_sz = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
         const auto scale_sz = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
@@ -592,22 +724,26 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             color_converted_input.emplace_back(gapi::NV12toRGB::on(inputs[0], inputs[1]));
         } else if (i420_input) {
             color_converted_input.emplace_back(gapi::I420toRGB::on(inputs[0], inputs[1], inputs[2]));
+        } else if (p010_input) {
+            color_converted_input.emplace_back(gapi::P010toRGB::on(inputs[0], inputs[1]));
+        } else if (yuyv_input || uyvy_input) {
+            color_converted_input.emplace_back(gapi::YUYVtoRGB::on(inputs[0], uyvy_input));
         } else {
             color_converted_input = inputs;
         }
 
         auto planes = drop_channel ?
                 to_vec(gapi::ScalePlanes4:: on(
-                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR))
+                        color_converted_input[0], in_prec, input_sz, scale_sz, cv::INTER_LINEAR))
               : to_vec(gapi::ScalePlanes  ::on(
-                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR));
+                        color_converted_input[0], in_prec, input_sz, scale_sz, cv::INTER_LINEAR));
 
         if (drop_channel) {
             planes.pop_back();
         }
 
         // if color conversion is done, output is RGB. but if BGR is required, reverse the planes
-        if (specific_yuv420_input_handling && output_color_format == ColorFormat::BGR) {
+        if (specific_yuv_input_handling && output_color_format == ColorFormat::BGR) {
             std::reverse(planes.begin(), planes.end());
         }
 
@@ -630,11 +766,19 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                            << number_of_planes << " != " << out_desc.d.C;
     }
 
+    // mean values and scales of output channels, applied together with conversion to output precision
+    const bool normalize = !mean.empty();
+    if (normalize && (mean.size() != planes.size() || scale.size() != planes.size())) {
+        IE_THROW() << "[G-API] internal error: number of mean values or scales "
+                           << "!= network's expected number of channels: "
+                           << mean.size() << ", " << scale.size() << " != " << planes.size();
+    }
+
     const int tmp_prec = CV_32F;
 
     std::vector<cv::GMat> outputs;
     const bool resize_needed = (algorithm != NO_RESIZE);
-    const bool need_tmp_prec_conv = resize_needed && (in_desc.prec != CV_8U) && (in_desc.prec != CV_32F);
+    const bool need_tmp_prec_conv = resize_needed && (in_prec != CV_8U) && (in_prec != CV_32F);
 
     if (resize_needed) {
         // resize every plane
@@ -644,6 +788,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_BICUBIC:  return cv::INTER_CUBIC;
             default: IE_THROW() << "Unsupported resize operation";
             }
         } (algorithm);
@@ -653,7 +798,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             const auto scale_sz  = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
 
             cv::GMat converted = m;
-            int prec = in_desc.prec;
+            int prec = in_prec;
 
             if (need_tmp_prec_conv) {
                 std::tie(converted, prec) = std::make_tuple(gapi::ConvertDepth::on(m, tmp_prec), tmp_prec);
@@ -666,7 +811,13 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (normalize) {
+        std::vector<cv::GMat> normalized;
+        for (size_t c = 0; c < outputs.size(); c++) {
+            normalized.emplace_back(gapi::Normalize::on(outputs[c], mean[c], scale[c], out_desc.prec));
+        }
+        outputs = normalized;
+    } else if ((in_prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -684,9 +835,59 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+
+// Part of the network input an image is resized into in letterbox mode:
+// image is scaled to fit preserving aspect ratio and centered
+cv::gapi::own::Rect letterboxRoi(const G::Dims &in, const G::Dims &out) {
+    const double scale = std::min(static_cast<double>(out.W) / in.W, static_cast<double>(out.H) / in.H);
+    const int width  = std::max(1, std::min(out.W, static_cast<int>(std::round(in.W * scale))));
+    const int height = std::max(1, std::min(out.H, static_cast<int>(std::round(in.H * scale))));
+    return cv::gapi::own::Rect{(out.W - width) / 2, (out.H - height) / 2, width, height};
+}
+
+template<typename T>
+void fillOutsideRoi(cv::gapi::own::Mat &mat, const cv::gapi::own::Rect &roi, float value) {
+    const auto lim = std::numeric_limits<T>::is_integer ? std::round(value) : value;
+    const T v = static_cast<T>(std::min<float>(std::max<float>(lim, std::numeric_limits<T>::lowest()),
+                                               std::numeric_limits<T>::max()));
+    const int chan = mat.channels();
+    for (int y = 0; y < mat.rows; y++) {
+        T *row = reinterpret_cast<T*>(mat.ptr(y));
+        if (y < roi.y || y >= roi.y + roi.height) {
+            std::fill(row, row + mat.cols * chan, v);
+        } else {
+            std::fill(row, row + roi.x * chan, v);
+            std::fill(row + (roi.x + roi.width) * chan, row + mat.cols * chan, v);
+        }
+    }
+}
+
+void fillOutsideRoi(cv::gapi::own::Mat &mat, const cv::gapi::own::Rect &roi, float value) {
+    switch (mat.depth()) {
+    case CV_8U:  fillOutsideRoi<uint8_t> (mat, roi, value); break;
+    case CV_16U: fillOutsideRoi<uint16_t>(mat, roi, value); break;
+    case CV_16S: fillOutsideRoi<int16_t> (mat, roi, value); break;
+    case CV_32F: fillOutsideRoi<float>   (mat, roi, value); break;
+    default: IE_THROW() << "Unsupported data type for letterbox resize";
+    }
+}
+// items of a batched blob cast to the expected blob type, empty if any item is of other type
+template<typename BlobType>
+std::vector<typename BlobType::Ptr> batchItemsAs(const std::vector<Blob::Ptr> &items) {
+    std::vector<typename BlobType::Ptr> result;
+    for (const auto &item : items) {
+        auto typed_item = as<BlobType>(item);
+        if (!typed_item) {
+            return {};
+        }
+        result.push_back(std::move(typed_item));
+    }
+    return result;
+}
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine()
+    : _lastComp(parallel_get_max_threads()), _lastRois(parallel_get_max_threads()) {}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -697,6 +898,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. mean values or scales have changed (affects kernel parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -704,13 +906,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -726,7 +930,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -762,11 +966,29 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
-    const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        IE_THROW()  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    // src is either a memory blob, an NV12, or an I420 blob, or a batched blob of those
+    std::vector<Blob::Ptr> items{src};
+    if (auto batched = as<BatchedBlob>(src)) {
+        items.clear();
+        for (size_t i = 0; i < batched->size(); ++i) {
+            items.push_back(batched->getBlob(i));
+        }
+        if (items.empty()) {
+            IE_THROW()  << "Invalid underlying blobs in BatchedBlob";
+        }
     }
+    for (const auto &item : items) {
+        if (!item) {
+            IE_THROW()  << "Invalid underlying blobs in BatchedBlob";
+        }
+        if (!item->is<MemoryBlob>() && !item->is<NV12Blob>() && !item->is<I420Blob>()) {
+            IE_THROW()  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+        }
+    }
+    // items of a batched blob are equal, so the first one represents all of them
+    validateBatchItems(items);
+    const auto &item = items.front();
+    const bool yuv420_blob = item->is<NV12Blob>() || item->is<I420Blob>();
 
     // dst is always a memory blob
     if (!dst->is<MemoryBlob>()) {
@@ -800,7 +1022,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         IE_THROW() << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>()) {
+        // every item of a batched blob is an image of the batch
+        const auto items = static_cast<int>(as<BatchedBlob>(blob)->size());
+        if (batch > items) {
+            IE_THROW()  << "Provided input blob batch size " << batch
+                                << " exceeds the number of batched blob items " << items;
+        }
+        if (batch < 0) {
+            batch = items;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             IE_THROW()  << "Provided input blob batch size " << batch
@@ -815,10 +1047,9 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
-    Update update) {
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial) {
 
     const int thread_num =
 #if IE_THREAD == IE_THREAD_OMP
@@ -835,53 +1066,77 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     // that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
+    // Slices are organized into groups: each group processes its own
+    // images of the batch, and each slice of a group computes its own
+    // row stripe of these images. So a single image is tiled into
+    // `total_slices` stripes, while images of a large batch are
+    // processed in parallel as a whole, with no per-stripe overhead.
+    //
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+        // every slice belongs to some group: the first `extra` groups have one stripe more
+        const int groups = std::min(batch_size, total_slices);
+        const int min_stripes = total_slices / groups;
+        const int extra = total_slices % groups;
+        const int extra_slices = extra * (min_stripes + 1);
+        int stripes = 0, stripe_n = 0, group_n = 0;
+        if (slice_n < extra_slices) {
+            stripes = min_stripes + 1;
+            group_n = slice_n / stripes;
+            stripe_n = slice_n % stripes;
+        } else {
+            stripes = min_stripes;
+            group_n = extra + (slice_n - extra_slices) / stripes;
+            stripe_n = (slice_n - extra_slices) % stripes;
+        }
 
-            using cv::gapi::own::Rect;
+        using cv::gapi::own::Rect;
 
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+        auto lines_per_thread = output_plane_mats[0].rows / stripes;
+        const auto remainder = output_plane_mats[0].rows % stripes;
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
+        // remainder shows how many stripes must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (stripe_n < remainder) {
+            lines_per_thread++;  // 1 additional row
+            roi_y = stripe_n * lines_per_thread;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to stripe_n have lines rows
+            roi_y =
+                remainder * (lines_per_thread + 1) + (stripe_n - remainder) * lines_per_thread;
+        }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        if (lines_per_thread <= 0) return;  // no job for current thread
+
+        const auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+
+        auto& compiled = _lastComp[slice_n];
+        auto& compiled_roi = _lastRois[slice_n];
+        if (!compiled || compiled_roi != roi) {
+            //  need to compile (or reshape) own object for a particular ROI
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
+            if (!compiled) {
+                auto& computation = _lastComputation.value();
                 compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descrs_of(input_plane_mats), std::move(args));
             }
+            compiled_roi = roi;
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        for (int i = group_n; i < batch_size; i += groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -897,11 +1152,17 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 }
 
 template<typename BlobTypePtr>
-void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+void PreprocEngine::preprocessBlob(const std::vector<BlobTypePtr> &inBlobs, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ResizeMode resize_mode, float pad_value, const std::vector<float> &mean,
+    const std::vector<float> &scale, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial, int batch_size) {
+
+    for (const auto &blob : inBlobs) {
+        validateBlob(blob);
+    }
+    validateBatchItems(inBlobs);
 
-    validateBlob(inBlob);
+    // several blobs are items of a batched blob, the first one describes all of them
+    const auto& inBlob = inBlobs.front();
 
     auto desc_and_layout = getTensorDescAndLayout(inBlob);
 
@@ -922,9 +1183,10 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 
     // according to the IE's current design, input blob batch size _must_ match networks's expected
     // batch size, even if the actual processing batch size (set on infer request) is different.
-    if (in_desc.d.N != out_desc.d.N) {
+    const int in_batch = inBlobs.size() > 1 ? static_cast<int>(inBlobs.size()) : in_desc.d.N;
+    if (in_batch != out_desc.d.N) {
         IE_THROW()  << "Input blob batch size is invalid: (input blob) "
-                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+                            << in_batch << " != " << out_desc.d.N << " (expected by network)";
     }
 
     // sanity check batch size
@@ -933,24 +1195,44 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    // normalization is fused with conversion to FP32 network's input
+    if (!mean.empty() && out_desc.prec != CV_32F) {
+        IE_THROW()  << "Input pre-processing normalization is supported for FP32 network's input only, got "
+                            << out_desc_ie.getPrecision();
+    }
+
+    // in letterbox mode the graph produces only the part of network's input
+    // the image is resized into, the rest of the input is filled with the pad value
+    const bool letterbox = (algorithm != NO_RESIZE) && (resize_mode == ResizeMode::LETTERBOX);
+    auto graph_out_desc = out_desc;
+    auto graph_out_dims = out_desc_ie.getDims();
+    cv::gapi::own::Rect out_roi{0, 0, out_desc.d.W, out_desc.d.H};
+    if (letterbox) {
+        out_roi = letterboxRoi(in_desc.d, out_desc.d);
+        graph_out_desc.d.W = out_roi.width;
+        graph_out_desc.d.H = out_roi.height;
+        graph_out_dims[2] = static_cast<size_t>(out_roi.height);
+        graph_out_dims[3] = static_cast<size_t>(out_roi.width);
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
                                             in_fmt },
                                   BlobDesc{ out_desc_ie.getPrecision(),
                                             out_layout,
-                                            out_desc_ie.getDims(),
+                                            graph_out_dims,
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  Normalization{ mean, scale } };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (algorithm == NO_RESIZE && mean.empty() && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
     const Update update = needUpdate(thisCall);
 
-    Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
         _lastCall = cv::util::make_optional(std::move(thisCall));
 
@@ -961,24 +1243,42 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
             auto custom_desc = getGDesc(in_desc, inBlob);
             _lastComputation = cv::util::make_optional(
                 buildGraph(custom_desc,
-                           out_desc,
+                           graph_out_desc,
                            in_layout,
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           mean,
+                           scale));
+
+            // compiled objects of the previous graph are not valid anymore,
+            // slices compile the new graph on demand
+            std::fill(_lastComp.begin(), _lastComp.end(), cv::GCompiled{});
         }
+
+        // input sizes may have changed, so compiled objects must be reshaped before use
+        std::fill(_lastRois.begin(), _lastRois.end(), cv::gapi::own::Rect{});
     }
 
-    auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
+    auto batched_input_plane_mats  = bind_to_blob(inBlobs, batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    if (letterbox) {
+        for (auto &output_plane_mats : batched_output_plane_mats) {
+            for (auto &mat : output_plane_mats) {
+                fillOutsideRoi(mat, out_roi, pad_value);
+                mat = mat(out_roi);
+            }
+        }
+    }
+
+    executeGraph(batched_input_plane_mats, batched_output_plane_mats, batch_size, omp_serial);
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ResizeMode resize_mode, float pad_value, const std::vector<float> &mean,
+        const std::vector<float> &scale, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -987,37 +1287,58 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
         IE_THROW()  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    // a batched blob is processed as a batch of its items
+    std::vector<Blob::Ptr> inBlobs;
+    if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+        for (size_t i = 0; i < inBatchedBlob->size(); ++i) {
+            inBlobs.push_back(inBatchedBlob->getBlob(i));
+        }
+    } else {
+        inBlobs.push_back(inBlob);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
-    // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
+    // if input color format is not NV12/P010 or I420, a MemoryBlob is expected. otherwise,
+    // NV12Blob (with U16 planes for P010) or I420Blob is expected
     switch (in_fmt) {
-    case ColorFormat::NV12: {
-        auto inNV12Blob = as<NV12Blob>(inBlob);
-        if (!inNV12Blob) {
+    case ColorFormat::NV12:
+    case ColorFormat::P010: {
+        auto inNV12Blobs = batchItemsAs<NV12Blob>(inBlobs);
+        if (inNV12Blobs.empty()) {
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        // NV12Blob planes are U8 for NV12 and U16 for P010, the kernels are selected by the color format
+        const auto expected_prec = (in_fmt == ColorFormat::P010) ? Precision::U16 : Precision::U8;
+        for (const auto &blob : inNV12Blobs) {
+            const auto prec = blob->y()->getTensorDesc().getPrecision();
+            if (prec != expected_prec) {
+                IE_THROW()  << "Unsupported input blob precision " << prec << " for color format " << in_fmt
+                                    << ": expected " << expected_prec;
+            }
+        }
+        return preprocessBlob(inNV12Blobs, outMemoryBlob, algorithm, resize_mode, pad_value, mean, scale,
+            in_fmt, out_fmt, omp_serial, batch_size);
     }
     case ColorFormat::I420: {
-        auto inI420Blob = as<I420Blob>(inBlob);
-        if (!inI420Blob) {
+        auto inI420Blobs = batchItemsAs<I420Blob>(inBlobs);
+        if (inI420Blobs.empty()) {
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blobs, outMemoryBlob, algorithm, resize_mode, pad_value, mean, scale,
+            in_fmt, out_fmt, omp_serial, batch_size);
     }
 
     default:
-        auto inMemoryBlob = as<MemoryBlob>(inBlob);
-        if (!inMemoryBlob) {
+        auto inMemoryBlobs = batchItemsAs<MemoryBlob>(inBlobs);
+        if (inMemoryBlobs.empty()) {
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlobs, outMemoryBlob, algorithm, resize_mode, pad_value, mean, scale,
+            in_fmt, out_fmt, omp_serial, batch_size);
     }
 }
 }  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
+#include <opencv2/gapi/own/types.hpp>
 #include <opencv2/gapi/util/optional.hpp>
 #include <openvino/itt.hpp>
 
@@ -22,11 +23,16 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    // per-channel mean values and scales, empty if no normalization is applied
+    using Normalization = std::tuple<std::vector<float>, std::vector<float>>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
+    Opt<cv::GComputation> _lastComputation;
+    // compiled objects of parallel slices and output ROIs they are compiled for
     std::vector<cv::GCompiled> _lastComp;
+    std::vector<cv::gapi::own::Rect> _lastRois;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -36,23 +42,22 @@ class PreprocEngine {
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
-                      const std::vector<std::vector<cv::gapi::own::Mat>>& src,
+    void executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
-                      bool omp_serial,
-                      Update update);
+                      bool omp_serial);
 
     template<typename BlobTypePtr>
-    void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+    void preprocessBlob(const std::vector<BlobTypePtr> &inBlobs, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ResizeMode resize_mode, float pad_value, const std::vector<float> &mean,
+        const std::vector<float> &scale, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial, int batch_size);
 
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
+        ResizeMode resize_mode, float pad_value, const std::vector<float> &mean, const std::vector<float> &scale,
         ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
 };
 
@@ -831,10 +831,37 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+// Rows r-1, r+1 and r+2 of the input at row r, so that bi-cubic resize
+// can read 4 rows within Fluid resize window of a single row
+G_TYPED_KERNEL_M(CubicRows, <GMat3(cv::GMat)>, "com.intel.ie.cubic_rows") {
+    static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(const cv::GMatDesc& in) {
+        GAPI_DbgAssert(in.chan == 1);
+        return std::make_tuple(in, in, in);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneCubic8u, <cv::GMat(cv::GMat, cv::GMat, cv::GMat, cv::GMat, Size, int)>,
+               "com.intel.ie.scale_plane_cubic_8u") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc&, const cv::GMatDesc &in, const cv::GMatDesc&, const cv::GMatDesc&,
+                                const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_8U && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneCubic32f, <cv::GMat(cv::GMat, cv::GMat, cv::GMat, cv::GMat, Size, int)>,
+               "com.intel.ie.scale_plane_cubic_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc&, const cv::GMatDesc &in, const cv::GMatDesc&, const cv::GMatDesc&,
+                                const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_CUBIC == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -861,6 +888,17 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_CUBIC == interp) {
+            cv::GMat above, below, below2;
+            std::tie(above, below, below2) = CubicRows::on(in);
+            if (CV_8UC1 == type) {
+                return ScalePlaneCubic8u::on(above, in, below, below2, szOut, interp);
+            }
+            if (CV_32FC1 == type) {
+                return ScalePlaneCubic32f::on(above, in, below, below2, szOut, interp);
+            }
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -2234,6 +2272,277 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+namespace cubic {
+// Cubic convolution coefficients with A = -0.75, as used by OpenCV
+static inline void coeffs(float x, float c[4]) {
+    constexpr float A = -0.75f;
+
+    c[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+    c[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+    c[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+    c[3] = 1.f - c[0] - c[1] - c[2];
+}
+
+static inline int clip(int x, int max) {
+    return (std::min)((std::max)(x, 0), max - 1);
+}
+}  // namespace cubic
+
+struct cubicScratchDesc {
+    float* alpha;  // 4 taps per output column, tap by tap
+    int*   mapsx;
+    float* beta;   // 4 weights per output row for rows mapsy-1 .. mapsy+2
+    int*   mapsy;
+    float* vbuf;   // vertically interpolated row
+
+    cubicScratchDesc(int /*inW*/, int /*inH*/, int outW, int outH, void* data) {
+        alpha = reinterpret_cast<float*>(data);
+        mapsx = reinterpret_cast<int*>  (alpha + outW*4);
+        beta  = reinterpret_cast<float*>(mapsx + outW*4);
+        mapsy = reinterpret_cast<int*>  (beta  + outH*4);
+        vbuf  = reinterpret_cast<float*>(mapsy + outH);
+    }
+
+    static int bufSize(int inW, int /*inH*/, int outW, int outH) {
+        auto size = outW * sizeof(float) * 4 +
+                    outW * sizeof(int)   * 4 +
+                    outH * sizeof(float) * 4 +
+                    outH * sizeof(int)       +
+                     inW * sizeof(float);
+
+        return static_cast<int>(size);
+    }
+};
+
+static void initScratchCubic(const cv::GMatDesc& in,
+                             const         Size& outSz,
+                             cv::gapi::fluid::Buffer& scratch) {
+    auto inSz = in.size;
+    auto sbufsize = cubicScratchDesc::bufSize(inSz.width, inSz.height, outSz.width, outSz.height);
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = Size{sbufsize, 1};
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    double hRatio = ratio(inSz.width, outSz.width);
+    double vRatio = ratio(inSz.height, outSz.height);
+
+    cubicScratchDesc scr(inSz.width, inSz.height, outSz.width, outSz.height, scratch.OutLineB());
+
+    float c[4];
+    for (int x = 0; x < outSz.width; x++) {
+        float f = static_cast<float>((x + 0.5) * hRatio - 0.5);
+        int s = cvFloor(f);
+        cubic::coeffs(f - s, c);
+
+        for (int k = 0; k < 4; k++) {
+            scr.alpha[k*outSz.width + x] = c[k];
+            scr.mapsx[k*outSz.width + x] = cubic::clip(s - 1 + k, inSz.width);
+        }
+    }
+
+    for (int y = 0; y < outSz.height; y++) {
+        float f = static_cast<float>((y + 0.5) * vRatio - 0.5);
+        int s = cvFloor(f);
+        cubic::coeffs(f - s, c);
+
+        // Kernel reads rows r-1 .. r+2 (clipped), where r is inside the image
+        // and inside the Fluid resize window. s-1 can be out of the image
+        // near the top, so weights of rows which are clipped to the same
+        // input row are merged
+        int r = cubic::clip(s, inSz.height);
+        scr.mapsy[y] = r;
+
+        float *beta = &scr.beta[4*y];
+        std::fill(beta, beta + 4, 0.f);
+        for (int k = 0; k < 4; k++) {
+            int row = cubic::clip(s - 1 + k, inSz.height);
+            for (int j = 0; j < 4; j++) {
+                if (cubic::clip(r - 1 + j, inSz.height) == row) {
+                    beta[j] += c[k];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+static void calcRowCubic(const cv::gapi::fluid::View  & in0,
+                         const cv::gapi::fluid::View  & in1,
+                         const cv::gapi::fluid::View  & in2,
+                         const cv::gapi::fluid::View  & in3,
+                               cv::gapi::fluid::Buffer& out,
+                               cv::gapi::fluid::Buffer& scratch) {
+    auto  inSz = in1.meta().size;
+    auto outSz = out.meta().size;
+
+    auto inY = in1.y();
+    int outY = out.y();
+    int lpi = out.lpi();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+    GAPI_DbgAssert(lpi <= 4);
+
+    cubicScratchDesc scr(inSz.width, inSz.height, outSz.width, outSz.height, scratch.OutLineB());
+
+    const auto *alpha = scr.alpha;
+    const auto *mapsx = scr.mapsx;
+    const auto *beta  = scr.beta + 4*outY;
+    const auto *mapsy = scr.mapsy;
+    auto *vbuf        = scr.vbuf;
+
+    // in0..in3 contain rows r-1, r, r+1 and r+2 at index r
+    const T *src[4*4];
+    T *dst[4];
+
+    for (int l = 0; l < lpi; l++) {
+        auto index = mapsy[outY + l] - inY;
+        src[4*l]     = in0.InLine<const T>(index);
+        src[4*l + 1] = in1.InLine<const T>(index);
+        src[4*l + 2] = in2.InLine<const T>(index);
+        src[4*l + 3] = in3.InLine<const T>(index);
+        dst[l] = out.OutLine<T>(l);
+    }
+
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::calcRowCubic_8UC1(reinterpret_cast<uint8_t**>(dst),
+                                      reinterpret_cast<const uint8_t**>(src),
+                                      alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowCubic_32F(reinterpret_cast<float**>(dst),
+                                     reinterpret_cast<const float**>(src),
+                                     alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::calcRowCubic_8UC1(reinterpret_cast<uint8_t**>(dst),
+                                   reinterpret_cast<const uint8_t**>(src),
+                                   alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowCubic_32F(reinterpret_cast<float**>(dst),
+                                  reinterpret_cast<const float**>(src),
+                                  alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            calcRowCubic_8UC1(reinterpret_cast<uint8_t**>(dst),
+                              reinterpret_cast<const uint8_t**>(src),
+                              alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            calcRowCubic_32F(reinterpret_cast<float**>(dst),
+                             reinterpret_cast<const float**>(src),
+                             alpha, mapsx, beta, vbuf, inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif  // HAVE_SSE
+
+    for (int l = 0; l < lpi; l++) {
+        const float *b = &beta[4*l];
+        for (int x = 0; x < inSz.width; x++) {
+            vbuf[x] = src[4*l][x]     * b[0] + src[4*l + 1][x] * b[1] +
+                      src[4*l + 2][x] * b[2] + src[4*l + 3][x] * b[3];
+        }
+
+        for (int x = 0; x < outSz.width; x++) {
+            float d = 0.f;
+            for (int k = 0; k < 4; k++) {
+                d += vbuf[mapsx[k*outSz.width + x]] * alpha[k*outSz.width + x];
+            }
+            dst[l][x] = saturate_cast<T>(d);
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FCubicRows, CubicRows, false) {
+    static const int Window = 5;
+
+    static void run(const cv::gapi::fluid::View& in,
+                    cv::gapi::fluid::Buffer& out0,
+                    cv::gapi::fluid::Buffer& out1,
+                    cv::gapi::fluid::Buffer& out2) {
+        const auto size = in.length() * CV_ELEM_SIZE(in.meta().depth);
+        std::copy_n(in.InLineB(-1), size, out0.OutLineB());
+        std::copy_n(in.InLineB(1),  size, out1.OutLineB());
+        std::copy_n(in.InLineB(2),  size, out2.OutLineB());
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/) {
+        return { cv::BORDER_REPLICATE, cv::Scalar() };
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneCubic8u, ScalePlaneCubic8u, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc&, const cv::GMatDesc& in, const cv::GMatDesc&, const cv::GMatDesc&,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchCubic(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in0, const cv::gapi::fluid::View& in1,
+                    const cv::gapi::fluid::View& in2, const cv::gapi::fluid::View& in3,
+                    Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowCubic<uint8_t>(in0, in1, in2, in3, out, scratch);
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneCubic32f, ScalePlaneCubic32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc&, const cv::GMatDesc& in, const cv::GMatDesc&, const cv::GMatDesc&,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchCubic(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in0, const cv::gapi::fluid::View& in1,
+                    const cv::gapi::fluid::View& in2, const cv::gapi::fluid::View& in3,
+                    Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowCubic<float>(in0, in1, in2, in3, out, scratch);
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2309,20 +2618,10 @@ static void calculate_i420_to_rgb_fallback(const  uchar **y_rows,
     }
 }
 
-GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
-    static const int Window = 1;
-    static const int LPI    = 2;
-    static const auto Kind = cv::GFluidKernel::Kind::YUV420toRGB;
-
-    static void run(const cv::gapi::fluid::View &in_y,
-                    const cv::gapi::fluid::View &in_uv,
-                          cv::gapi::fluid::Buffer &out) {
-        const uchar* uv_row = in_uv.InLineB(0);
-        const uchar* y_rows[2] = {in_y. InLineB(0), in_y. InLineB(1)};
-        uchar* out_rows[2] = {out.OutLineB(0), out.OutLineB(1)};
-
-        int buf_width = out.length();
-
+static void calculate_nv12_to_rgb_dispatch(const  uchar **y_rows,
+                                           const  uchar *uv_row,
+                                                  uchar **out_rows,
+                                           int buf_width) {
 // AVX512 implementation of wide universal intrinsics is slower than AVX2.
 // It is turned off until the cause isn't found out.
     #if 0
@@ -2354,6 +2653,69 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
     #endif  // HAVE_NEON
 
         calculate_nv12_to_rgb_fallback(y_rows, uv_row, out_rows, buf_width);
+}
+
+GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
+    static const int Window = 1;
+    static const int LPI    = 2;
+    static const auto Kind = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const cv::gapi::fluid::View &in_y,
+                    const cv::gapi::fluid::View &in_uv,
+                          cv::gapi::fluid::Buffer &out) {
+        const uchar* uv_row = in_uv.InLineB(0);
+        const uchar* y_rows[2] = {in_y. InLineB(0), in_y. InLineB(1)};
+        uchar* out_rows[2] = {out.OutLineB(0), out.OutLineB(1)};
+
+        int buf_width = out.length();
+
+        calculate_nv12_to_rgb_dispatch(y_rows, uv_row, out_rows, buf_width);
+    }
+};
+
+// 10-bit samples are in the high bits of P010 elements. They are converted with two more bits
+// of the fixed point precision than 8-bit ones, so the result is rounded only once
+static void calculate_p010_to_rgb(const uint16_t **y_rows,
+                                  const uint16_t *uv_row,
+                                         uchar **out_rows,
+                                  int buf_width) {
+    const int shift = ITUR_BT_601_SHIFT + 2;
+    // the sum of Y and UV terms exceeds int range for 10-bit samples
+    const int64_t half = int64_t(1) << (shift - 1);
+    for (int i = 0; i < buf_width; i += 2) {
+        const int64_t uu = (uv_row[i] >> 6) - 512;
+        const int64_t vv = (uv_row[i + 1] >> 6) - 512;
+        const int64_t ruv = half + ITUR_BT_601_CVR * vv;
+        const int64_t guv = half + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+        const int64_t buv = half + ITUR_BT_601_CUB * uu;
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                const int64_t yy = std::max(0, (y_rows[y][i + x] >> 6) - 64) * int64_t(ITUR_BT_601_CY);
+
+                out_rows[y][3*(i + x)]     = saturate_cast<uchar>(static_cast<int>((yy + ruv) >> shift));
+                out_rows[y][3*(i + x) + 1] = saturate_cast<uchar>(static_cast<int>((yy + guv) >> shift));
+                out_rows[y][3*(i + x) + 2] = saturate_cast<uchar>(static_cast<int>((yy + buv) >> shift));
+            }
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FP010toRGB, P010toRGB, false) {
+    static const int Window = 1;
+    static const int LPI    = 2;
+    static const auto Kind = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const cv::gapi::fluid::View &in_y,
+                    const cv::gapi::fluid::View &in_uv,
+                          cv::gapi::fluid::Buffer &out) {
+        const uint16_t* uv_row = in_uv.InLine<uint16_t>(0);
+        const uint16_t* y_rows[2] = {in_y.InLine<uint16_t>(0), in_y.InLine<uint16_t>(1)};
+        uchar* out_rows[2] = {out.OutLineB(0), out.OutLineB(1)};
+
+        int buf_width = out.length();
+
+        calculate_p010_to_rgb(y_rows, uv_row, out_rows, buf_width);
     }
 };
 
@@ -2408,6 +2770,60 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
     }
 };
 
+static void calculate_yuyv_to_rgb_fallback(const uchar *src, uchar *out, int buf_width, bool uyvy) {
+    const int iy0 = uyvy ? 1 : 0;
+    const int iu  = uyvy ? 0 : 1;
+    const int iy1 = uyvy ? 3 : 2;
+    const int iv  = uyvy ? 2 : 3;
+
+    for (int i = 0; i < buf_width; i += 2) {
+        const uchar *pair = src + 2*i;
+        int ruv, guv, buv;
+        uvToRGBuv(pair[iu], pair[iv], ruv, guv, buv);
+
+        for (int x = 0; x < 2; x++) {
+            uchar r, g, b;
+            yRGBuvToRGB(pair[x == 0 ? iy0 : iy1], ruv, guv, buv, r, g, b);
+
+            out[3*(i + x)]     = r;
+            out[3*(i + x) + 1] = g;
+            out[3*(i + x) + 2] = b;
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FYUYVtoRGB, YUYVtoRGB, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View &in, bool uyvy,
+                          cv::gapi::fluid::Buffer &out) {
+        const uchar* in_row = in.InLineB(0);
+        uchar* out_row = out.OutLineB();
+
+        int buf_width = out.length();
+
+    #ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            avx::calculate_yuyv_to_rgb(in_row, out_row, buf_width, uyvy);
+            return;
+        }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) {
+            calculate_yuyv_to_rgb(in_row, out_row, buf_width, uyvy);
+            return;
+        }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+        neon::calculate_yuyv_to_rgb(in_row, out_row, buf_width, uyvy);
+        return;
+    #endif  // HAVE_NEON
+
+        calculate_yuyv_to_rgb_fallback(in_row, out_row, buf_width, uyvy);
+    }
+};
+
 namespace {
 
 template <typename src_t, typename dst_t>
@@ -2461,6 +2877,44 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+template <typename src_t>
+void normalize(const uint8_t* src, uint8_t* dst, const int width, float mean, float scale) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<float *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = (static_cast<float>(in[i]) - mean) * scale;
+    }
+}
+
+}  // namespace
+
+GAPI_FLUID_KERNEL(FNormalize, Normalize, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, int /*depth*/,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLineB();
+
+        auto const width = dst.length();
+
+        switch (src.meta().depth) {
+        case CV_8U:  normalize<uint8_t> (in, out, width, mean, scale); break;
+        case CV_16U: normalize<uint16_t>(in, out, width, mean, scale); break;
+        case CV_32F: normalize<float>   (in, out, width, mean, scale); break;
+        default: GAPI_Assert(!"not supported depth");
+        }
+    }
+};
+
 namespace {
     template <typename src_t, typename dst_t>
     void sub(const uint8_t* src, uint8_t* dst, const int width, double c) {
@@ -2531,6 +2985,9 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FCubicRows
+        , FScalePlaneCubic8u
+        , FScalePlaneCubic32f
         , FMerge2
         , FMerge3
         , FMerge4
@@ -2539,7 +2996,10 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FSplit4
         , FNV12toRGB
         , FI420toRGB
+        , FYUYVtoRGB
+        , FP010toRGB
         , FConvertDepth
+        , FNormalize
         , FSubC
         , FDivC
         >();
@@ -143,6 +143,30 @@ namespace gapi {
         }
     };
 
+    // packed 4:2:2 image: YUYV, or UYVY if the flag is set
+    G_TYPED_KERNEL(YUYVtoRGB, <cv::GMat(cv::GMat, bool)>, "com.intel.ie.yuyvtorgb") {
+        static cv::GMatDesc outMeta(cv::GMatDesc in, bool /*uyvy*/) {
+            GAPI_Assert(in.chan == 2);
+            GAPI_Assert(in.depth == CV_8U);
+            GAPI_Assert(in.size.width % 2 == 0);
+            return in.withType(CV_8U, 3);
+        }
+    };
+
+    // 10-bit samples in the high bits of 16-bit Y and UV planes, output is 8-bit
+    G_TYPED_KERNEL(P010toRGB, <cv::GMat(cv::GMat, cv::GMat)>, "com.intel.ie.p010torgb") {
+        static cv::GMatDesc outMeta(cv::GMatDesc in_y, cv::GMatDesc in_uv) {
+            GAPI_Assert(in_y.chan == 1);
+            GAPI_Assert(in_uv.chan == 2);
+            GAPI_Assert(in_y.depth == CV_16U);
+            GAPI_Assert(in_uv.depth == CV_16U);
+            // UV size should be aligned with Y
+            GAPI_Assert(in_y.size.width == 2 * in_uv.size.width);
+            GAPI_Assert(in_y.size.height == 2 * in_uv.size.height);
+            return in_y.withType(CV_8U, 3);
+        }
+    };
+
     G_TYPED_KERNEL(ConvertDepth, <cv::GMat(cv::GMat, int depth)>, "com.intel.ie.ConvertDepth") {
         static cv::GMatDesc outMeta(const cv::GMatDesc& in, int depth) {
             GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
@@ -152,6 +176,16 @@ namespace gapi {
         }
     };
 
+    // (src - mean) * scale, converted to the given depth
+    G_TYPED_KERNEL(Normalize, <cv::GMat(cv::GMat, float, float, int)>, "com.intel.ie.Normalize") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float /*mean*/, float /*scale*/, int depth) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
+            GAPI_Assert(depth == CV_32F);
+
+            return in.withDepth(depth);
+        }
+    };
+
     G_TYPED_KERNEL(GSubC, <cv::GMat(cv::GMat, cv::GScalar, int)>, "com.intel.ie.math.subC") {
         static cv::GMatDesc outMeta(cv::GMatDesc a, cv::GScalarDesc, int ddepth) {
             return a.withDepth(ddepth);
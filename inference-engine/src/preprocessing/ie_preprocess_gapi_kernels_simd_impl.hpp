@@ -605,6 +605,61 @@ CV_ALWAYS_INLINE void calculate_i420_to_rgb_impl(const  uchar **srcY, const  uch
     }
 }
 
+// packed 4:2:2 row: YUYV is Y0 U Y1 V, UYVY is U Y0 V Y1 per pair of pixels
+CV_ALWAYS_INLINE void calculate_yuyv_to_rgb_impl(const uchar *src, uchar *dstRGBx,
+                                                 int width, bool uyvy) {
+    // positions of even pixel luma, U, odd pixel luma and V within a pair of pixels
+    const int iy0 = uyvy ? 1 : 0;
+    const int iu  = uyvy ? 0 : 1;
+    const int iy1 = uyvy ? 3 : 2;
+    const int iv  = uyvy ? 2 : 3;
+
+    int i = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint8::nlanes;
+
+    for ( ; i <= width - 2*nlanes; i += 2*nlanes) {
+        v_uint8 c[4];
+        v_load_deinterleave(src + 2*i, c[0], c[1], c[2], c[3]);
+
+        v_int32 ruv[4], guv[4], buv[4];
+        uvToRGBuv(c[iu], c[iv], ruv, guv, buv);
+
+        v_uint8 r[2], g[2], b[2];
+        yRGBuvToRGB(c[iy0], ruv, guv, buv, r[0], g[0], b[0]);
+        yRGBuvToRGB(c[iy1], ruv, guv, buv, r[1], g[1], b[1]);
+
+        // [even...], [odd...] => [even, odd, even, odd...]
+        v_uint8 r0, r1, g0, g1, b0, b1;
+        v_zip(r[0], r[1], r0, r1);
+        v_zip(g[0], g[1], g0, g1);
+        v_zip(b[0], b[1], b0, b1);
+
+        v_store_interleave(dstRGBx + i * 3, r0, g0, b0);
+        v_store_interleave(dstRGBx + i * 3 + 3 * nlanes, r1, g1, b1);
+    }
+
+    vx_cleanup();
+
+#endif
+
+    for (; i < width; i += 2) {
+        const uchar *pair = src + 2*i;
+        int ruv, guv, buv;
+        uvToRGBuv(pair[iu], pair[iv], ruv, guv, buv);
+
+        for (int x = 0; x < 2; x++) {
+            uchar r, g, b;
+            yRGBuvToRGB(pair[x == 0 ? iy0 : iy1], ruv, guv, buv, r, g, b);
+
+            dstRGBx[3*(i + x)]     = r;
+            dstRGBx[3*(i + x) + 1] = g;
+            dstRGBx[3*(i + x) + 2] = b;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 
 // vertical pass
@@ -916,6 +971,98 @@ CV_ALWAYS_INLINE void calcRowLinear_32FC1(float *dst[],
     }
 }
 
+#if MANUAL_SIMD
+CV_ALWAYS_INLINE v_float32 vx_load_as_f32(const uint8_t* ptr) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(ptr)));
+}
+
+CV_ALWAYS_INLINE v_float32 vx_load_as_f32(const float* ptr) {
+    return vx_load(ptr);
+}
+
+// stores 2*nlanes values
+CV_ALWAYS_INLINE void v_store_from_f32(uint8_t* ptr, const v_float32& a, const v_float32& b) {
+    v_pack_u_store(ptr, v_pack(v_round(a), v_round(b)));
+}
+
+CV_ALWAYS_INLINE void v_store_from_f32(float* ptr, const v_float32& a, const v_float32& b) {
+    vx_store(ptr, a);
+    vx_store(ptr + v_float32::nlanes, b);
+}
+#endif
+
+// Resize (bi-cubic, 8UC1 and 32FC1)
+// src contains 4 rows per line, alpha and mapsx contain 4 taps per output pixel
+// stored tap by tap (alpha[k*outSz.width + x]), beta contains 4 weights per line.
+// Rows are interpolated vertically into vbuf first, so horizontal interpolation
+// is done once per output pixel rather than once per row.
+template<typename T>
+CV_ALWAYS_INLINE void calcRowCubic_impl(T*          dst[],
+                                        const T*    src[],
+                                        const float alpha[],
+                                        const int   mapsx[],
+                                        const float beta[],
+                                        float       vbuf[],
+                                        const Size& inSz,
+                                        const Size& outSz,
+                                        const int   lpi) {
+    const int inW  = inSz.width;
+    const int outW = outSz.width;
+
+    const float *alpha0 = alpha, *alpha1 = alpha + outW, *alpha2 = alpha + 2*outW, *alpha3 = alpha + 3*outW;
+    const int   *mapsx0 = mapsx, *mapsx1 = mapsx + outW, *mapsx2 = mapsx + 2*outW, *mapsx3 = mapsx + 3*outW;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+#endif
+
+    for (int line = 0; line < lpi; ++line) {
+        const T *s0 = src[4*line], *s1 = src[4*line + 1], *s2 = src[4*line + 2], *s3 = src[4*line + 3];
+        const float *b = &beta[4*line];
+
+        int x = 0;
+
+#if MANUAL_SIMD
+        v_float32 b0 = vx_setall_f32(b[0]), b1 = vx_setall_f32(b[1]);
+        v_float32 b2 = vx_setall_f32(b[2]), b3 = vx_setall_f32(b[3]);
+        for (; x <= inW - nlanes; x += nlanes) {
+            v_float32 v = vx_load_as_f32(&s0[x]) * b0;
+            v = v_fma(vx_load_as_f32(&s1[x]), b1, v);
+            v = v_fma(vx_load_as_f32(&s2[x]), b2, v);
+            v = v_fma(vx_load_as_f32(&s3[x]), b3, v);
+            vx_store(&vbuf[x], v);
+        }
+#endif
+
+        for (; x < inW; ++x) {
+            vbuf[x] = s0[x] * b[0] + s1[x] * b[1] + s2[x] * b[2] + s3[x] * b[3];
+        }
+
+        x = 0;
+
+#if MANUAL_SIMD
+        for (; x <= outW - 2*nlanes; x += 2*nlanes) {
+            v_float32 d[2];
+            for (int i = 0; i < 2; ++i) {
+                const int xi = x + i*nlanes;
+                v_float32 h = v_lut(vbuf, vx_load(&mapsx0[xi])) * vx_load(&alpha0[xi]);
+                h = v_fma(v_lut(vbuf, vx_load(&mapsx1[xi])), vx_load(&alpha1[xi]), h);
+                h = v_fma(v_lut(vbuf, vx_load(&mapsx2[xi])), vx_load(&alpha2[xi]), h);
+                h = v_fma(v_lut(vbuf, vx_load(&mapsx3[xi])), vx_load(&alpha3[xi]), h);
+                d[i] = h;
+            }
+            v_store_from_f32(&dst[line][x], d[0], d[1]);
+        }
+#endif
+
+        for (; x < outW; ++x) {
+            float d = vbuf[mapsx0[x]] * alpha0[x] + vbuf[mapsx1[x]] * alpha1[x] +
+                      vbuf[mapsx2[x]] * alpha2[x] + vbuf[mapsx3[x]] * alpha3[x];
+            dst[line][x] = saturate_cast<T>(d);
+        }
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -28,6 +29,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -91,6 +93,49 @@ T stringToType(const std::string& valStr) {
     return ret;
 }
 
+using WeightsBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+
+struct ConstantData {
+    ngraph::element::Type type;
+    ngraph::Shape shape;
+    std::shared_ptr<WeightsBuffer> buffer;
+    std::exception_ptr error;
+};
+
+/// \brief Reads element type and shape of a Const layer and checks its data in the weights blob.
+/// \param dn xml 'data' node of the layer
+/// \return false if element type or shape is not specified
+bool parseConstantData(
+    const pugi::xml_node& dn,
+    const std::string& type,
+    const Blob::CPtr& weights,
+    ConstantData& data) {
+    std::vector<size_t> shape;
+    std::string el_type_str;
+
+    size_t offset = XMLParseUtils::GetUInt64Attr(dn, "offset");
+    size_t size = XMLParseUtils::GetUInt64Attr(dn, "size");
+    if (!getStrAttribute(dn, "element_type", el_type_str)) return false;
+    if (!getParameters<size_t>(dn, "shape", shape)) return false;
+
+    ngraph::element::Type el_type = details::convertPrecision(el_type_str);
+
+    size_t length = weights->byteSize();
+    if (!length)
+        IE_THROW() << "Empty weights data in bin file or bin file cannot be found!";
+    if (length < offset + size) IE_THROW() << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        IE_THROW() << "Attribute and shape size are inconsistent for " << type
+                           << " op!";
+
+    char* ptr = weights->cbuffer().as<char*>() + offset;
+
+    data.type = el_type;
+    data.shape = ngraph::Shape(shape);
+    data.buffer = std::make_shared<WeightsBuffer>(ptr, size, weights);
+    return true;
+}
+
 class XmlDeserializer : public ngraph::AttributeVisitor {
 public:
     /// TODO: move whole class to src file
@@ -202,11 +247,20 @@ private:
 
     V10Parser::GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief Reads data of a Const layer which can be created without attribute visitor.
+    /// Errors are stored to be reported only if the layer is a part of the function.
+    /// \return empty data for other layers
+    ConstantData parseSharedConstant(
+        const pugi::xml_node& node,
+        const Blob::CPtr& weights,
+        const V10Parser::GenericLayerParams& params) const;
+
     std::shared_ptr<ngraph::Node> createNode(
         const ngraph::OutputVector& inputs,
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
-        const V10Parser::GenericLayerParams& params);
+        const V10Parser::GenericLayerParams& params,
+        const ConstantData& constant);
 
     // -- DATA --
     const pugi::xml_node node;
@@ -496,29 +550,9 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
             value.copy(data, value.size());
             a->set(buffer);
         } else if (name == "value" && type == "Const") {
-            std::vector<int64_t> shape;
-            std::string el_type_str;
-
-            size_t offset = XMLParseUtils::GetUInt64Attr(dn, "offset");
-            size_t size = XMLParseUtils::GetUInt64Attr(dn, "size");
-            if (!getStrAttribute(dn, "element_type", el_type_str)) return;
-            if (!getParameters<int64_t>(dn, "shape", shape)) return;
-
-            ngraph::element::Type el_type = details::convertPrecision(el_type_str);
-
-            size_t length = weights->byteSize();
-            if (!length)
-                IE_THROW() << "Empty weights data in bin file or bin file cannot be found!";
-            if (length < offset + size) IE_THROW() << "Incorrect weights in bin file!";
-            if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
-                IE_THROW() << "Attribute and shape size are inconsistent for " << type
-                                   << " op!";
-
-            char* data = weights->cbuffer().as<char*>() + offset;
-
-            using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
-            auto buffer = std::make_shared<SharedBuffer>(data, size, weights);
-            a->set(buffer);
+            ConstantData data;
+            if (!parseConstantData(dn, type, weights, data)) return;
+            a->set(data.buffer);
         }
     } else {
         IE_THROW() << "Error IR reading. Attribute adapter can not be found for " << name
@@ -560,6 +594,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     struct node_params {
         pugi::xml_node xml;
         V10Parser::GenericLayerParams params;
+        ConstantData constant;
     };
 
     std::map<size_t/*layer-id*/, node_params> params;
@@ -567,16 +602,35 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
-    // Read all layers and store their parameters in params map
+    std::vector<node_params> layers;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layers.push_back({node, {}, {}});
+    }
+
+    // Layer parameters and data of constants don't depend on other layers, so they are read in
+    // parallel. nGraph nodes are created in topological order afterwards.
+    std::vector<std::exception_ptr> layer_errors(layers.size());
+    parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers[i].params = parseGenericParams(layers[i].xml);
+            layers[i].constant = parseSharedConstant(layers[i].xml, weights, layers[i].params);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+        }
+    });
+
+    // Store layers parameters in params map
+    for (size_t i = 0; i < layers.size(); i++) {
+        if (layer_errors[i]) std::rethrow_exception(layer_errors[i]);
+
+        const auto& node_param = layers[i].params;
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        params[node_param.layerId] = std::move(layers[i]);
     }
 
     std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
@@ -629,7 +683,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = createNode(inputs, p.xml, weights, p.params, p.constant);
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -742,11 +796,35 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
     return params;
 }
 
+ConstantData XmlDeserializer::parseSharedConstant(
+    const pugi::xml_node& node,
+    const Blob::CPtr& weights,
+    const V10Parser::GenericLayerParams& params) const {
+    ConstantData constant;
+    if (params.type != "Const") return constant;
+
+    auto opsetIt = opsets.find(params.version);
+    if (opsetIt == opsets.end() || !opsetIt->second.contains_type<ngraph::op::v0::Constant>())
+        return constant;
+
+    // Constants with values stored in xml are created by attribute visitor
+    pugi::xml_node dn = node.child("data");
+    if (dn.empty() || dn.attribute("value")) return constant;
+
+    try {
+        parseConstantData(dn, params.type, weights, constant);
+    } catch (...) {
+        constant.error = std::current_exception();
+    }
+    return constant;
+}
+
 std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
     const pugi::xml_node& node,
     const Blob::CPtr& weights,
-    const V10Parser::GenericLayerParams& params) {
+    const V10Parser::GenericLayerParams& params,
+    const ConstantData& constant) {
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -761,6 +839,13 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
 
     std::shared_ptr<ngraph::Node> ngraphNode;
 
+    // Share weights from constant blob, its data was read beforehand
+    if (constant.error) std::rethrow_exception(constant.error);
+    if (constant.buffer) {
+        ngraphNode = std::make_shared<ngraph::op::v0::Constant>(
+            constant.type, constant.shape, constant.buffer);
+    }
+
     // Find registered opset
     auto opsetIt = opsets.find(params.version);
 
@@ -50,10 +50,31 @@ struct DataMetaInfo final {
     std::vector<size_t> childrenIndices;
 };
 
+//
+// Peak values are the high water marks of the memory pools, live values are the largest amounts of memory
+// used by data objects at the same time, the difference between them is lost to fragmentation.
+//
+
+struct AllocationStatistics final {
+    int peakCMX = 0;
+    int peakLiveCMX = 0;
+    int peakDDR = 0;
+    int peakLiveDDR = 0;
+
+    // Data objects moved from CMX to DDR because CMX ran out
+    int spilledDatas = 0;
+    int spilledBytes = 0;
+
+    // Offline CMX packing: data objects placed at the planned offsets and allocated by best fit instead
+    int plannedDatas = 0;
+    int unplannedDatas = 0;
+};
+
 struct GraphMetaInfo final {
     std::string graphName;
     std::vector<StageMetaInfo> stagesMeta;
     std::vector<DataMetaInfo> datasMeta;
+    AllocationStatistics allocationStatistics;
 };
 
 VPU_DECLARE_ENUM(PerfReport,
@@ -55,6 +55,23 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    //
+    // Makes environment of the compiling thread current for a helper thread,
+    // which evaluates independent parts of compilation in parallel.
+    // Helper threads must not modify the environment.
+    //
+    class ThreadBinding final {
+    public:
+        explicit ThreadBinding(const CompileEnv& env);
+        ~ThreadBinding();
+
+        ThreadBinding(const ThreadBinding&) = delete;
+        ThreadBinding& operator=(const ThreadBinding&) = delete;
+
+    private:
+        CompileEnv* _prevEnv = nullptr;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
@@ -51,6 +51,8 @@ struct CompilationConfig final {
 
     std::string irWithVpuScalesDir;
 
+    std::string tilingCacheDir;
+
     std::string customLayers;
 
     bool detectBatch = true;
@@ -114,6 +116,7 @@ struct CompilationConfig final {
     bool enableWeightsAnalysis = true;
     bool checkPreprocessingInsideModel = true;
     bool enableCustomReshapeParam = false;
+    bool enableOfflineCmxPacking = false;
 
     //
     // Deprecated options
@@ -6,9 +6,11 @@
 
 #include <unordered_set>
 #include <list>
+#include <utility>
 #include <vector>
 
 #include <vpu/utils/enums.hpp>
+#include <vpu/utils/perf_report.hpp>
 #include <vpu/model/stage.hpp>
 #include <vpu/model/data.hpp>
 #include <vpu/model/edges.hpp>
@@ -32,6 +34,13 @@ struct UsedMemory final {
 void printTo(std::ostream& os, const UsedMemory& usedMemory);
 void printTo(DotLabel& lbl, const UsedMemory& usedMemory);
 
+//
+// AllocationStatistics
+//
+
+void printTo(std::ostream& os, const AllocationStatistics& statistics);
+void printTo(DotLabel& lbl, const AllocationStatistics& statistics);
+
 //
 // AllocationResult
 //
@@ -83,6 +92,7 @@ public:
     void selfCheck();
 
     UsedMemory usedMemoryAmount() const;
+    AllocationStatistics statistics() const;
     std::size_t freeMemoryAmount(const MemoryType& type) const;
 
     DataVector getAllocatedDatas(MemoryType memType) const;
@@ -96,14 +106,22 @@ public:
     DataSet& getCandidatesForCMX() { return _candidatesForCMX; }
     bool removeCMXCandidates(const Data& data);
 
+    /**
+     * Planned offsets are used for CMX data objects, when their regions are free at allocation time
+     */
+    void setCMXPackingPlan(DataMap<int> offsets) { _cmxPackingPlan = std::move(offsets); }
+    bool hasCMXPackingPlan() const { return !_cmxPackingPlan.empty(); }
+
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
 private:
     allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
+    allocator::MemChunk* allocateMemAt(MemoryType memType, int offset, int size, int inUse);
     void freeMem(allocator::MemChunk* chunk);
 
     allocator::MemChunk* addNewChunk(allocator::MemoryPool& pool, MemoryType memType, int offset, int pointer, int size, int inUse);
     allocator::MemChunk* checkMemPool(allocator::MemoryPool& pool, MemoryType memType, int size, int inUse);
+    static void updateMemUsage(allocator::MemoryPool& pool, const allocator::MemChunk* chunk);
 
     void extractDatas(MemoryType memType, const DataSet& from, DataVector& out) const;
 
@@ -138,6 +156,13 @@ private:
     bool _needToAllocNonIntermData = true;
 
     DataSet _candidatesForCMX;
+
+    DataMap<int> _cmxPackingPlan;
+
+    int _spilledDatas = 0;
+    int _spilledBytes = 0;
+    int _plannedDatas = 0;
+    int _unplannedDatas = 0;
 };
 
 int calcAllocationSize(const Data& data);
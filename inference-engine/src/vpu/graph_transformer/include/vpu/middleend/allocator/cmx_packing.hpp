@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vpu/model/model.hpp>
+
+namespace vpu {
+
+//
+// DataLifetime
+//
+
+//
+// Indices of the first and the last stages (in execution order) which use memory of top parent data object.
+// Data objects, which shapes are used by network inputs/outputs, live till the end of the network.
+//
+
+struct DataLifetime final {
+    int begin = 0;
+    int end = 0;
+
+    int length() const { return end - begin + 1; }
+    bool intersects(const DataLifetime& other) const { return begin <= other.end && other.begin <= end; }
+};
+
+DataMap<DataLifetime> calcDataLifetimes(const Model& model);
+
+//
+// CMXPackingPlan
+//
+
+//
+// Offline packing of CMX data objects: lifetimes are intervals on stages order, they are placed one by one
+// (the largest first) between regions of already placed intersecting intervals. Candidate offsets are the tightest
+// gaps and the end of the last region, each of them is tried with a few following data objects placed in advance,
+// the one giving the lowest peak is taken. The plan of plain best fit is used instead if its peak is lower.
+// Unlike greedy allocation in stages order, it sees the whole network and doesn't leave holes for data allocated later.
+// Planned offsets are hints for Allocator, it uses them only if the region is free at allocation time.
+//
+
+struct CMXPackingPlan final {
+    DataMap<int> offsets;
+    int peakSize = 0;
+};
+
+CMXPackingPlan planCMXPacking(const Model& model);
+
+//
+// CMXPacker
+//
+
+//
+// Keeps the packing plan between allocation runs, which change only memory requirements of data objects
+// (stages order is the same), so lifetimes are calculated and the plan is built once.
+// Added data objects are placed to the tightest gap of the plan, already planned ones are not moved.
+//
+
+class CMXPacker final {
+public:
+    explicit CMXPacker(const Model& model);
+
+    const DataMap<DataLifetime>& lifetimes() const { return _lifetimes; }
+    const CMXPackingPlan& plan() const { return _plan; }
+
+    void add(const Data& data);
+    void remove(const Data& data);
+
+private:
+    DataMap<DataLifetime> _lifetimes;
+    DataMap<int> _sizes;
+    CMXPackingPlan _plan;
+};
+
+//
+// Runs allocation with the given plan, greedy allocation in stages order is the fallback
+//
+
+AllocationResult runAllocator(
+        const Model& model,
+        const CMXPackingPlan& plan,
+        EnableShapeAllocation enableShapeAllocation,
+        CheckOnlyCMX checkOnlyCmx);
+
+}  // namespace vpu
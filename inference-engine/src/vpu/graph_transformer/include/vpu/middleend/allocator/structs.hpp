@@ -47,12 +47,16 @@ struct FreeMemory final {
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
+    int memLive = 0;
+    int maxMemLive = 0;
     std::list<MemChunk> allocatedChunks;
     SmallVector<FreeMemory> freePool;
 
     void clear() {
         curMemOffset = 0;
         memUsed = 0;
+        memLive = 0;
+        maxMemLive = 0;
         allocatedChunks.clear();
         freePool.clear();
     }
@@ -59,6 +59,14 @@ struct TilingOption final {
 
 bool operator<(const TilingOption& lhs, const TilingOption& rhs);
 
+// Result of tiling search, hw tilings are prepared from it without repeating the search
+struct TilingSearchResult final {
+    std::vector<TilingOption> tilingOptions;
+    // Tile sizes left by the search, tile cuts of the options start from them
+    DimValues inputTileDims;
+    DimValues outputTileDims;
+};
+
 std::ostream& operator<<(std::ostream& stream, const TilingOption& tilingOption);
 
 enum class Direction {
@@ -140,7 +148,7 @@ public:
         _convolutionOptions(other._convolutionOptions),
         _maxTilingOptions(other._maxTilingOptions),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
-        _tilingOptions(other._tilingOptions) {}
+        _searchResult(other._searchResult) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
                                 std::size_t maxTilingOptions) :
         _convolutionOptions(std::move(convolutionOptions)),
@@ -148,11 +156,29 @@ public:
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _searchResult.tilingOptions = selectBetterTiling();
+            _searchResult.inputTileDims = _dirTiling->getInputTileDims();
+            _searchResult.outputTileDims = _dirTiling->getOutputTileDims();
+        }
+
+    // Takes result of the search done before for the same options instead of searching again
+    HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                TilingSearchResult searchResult) :
+        _convolutionOptions(std::move(convolutionOptions)),
+        _maxTilingOptions(searchResult.tilingOptions.size()),
+        _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
+        _searchResult(std::move(searchResult)) {
+            _dirTiling->initTileSizes();
+            _dirTiling->resetInputTileDims(_searchResult.inputTileDims);
+            _dirTiling->resetOutputTileDims(_searchResult.outputTileDims);
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
-        return _tilingOptions;
+        return _searchResult.tilingOptions;
+    }
+
+    const TilingSearchResult& searchResult() const {
+        return _searchResult;
     }
 
     const ConvolutionOptions& convolutionOptions() const { return _convolutionOptions; }
@@ -165,7 +191,7 @@ private:
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
     const std::unique_ptr<GraphDataTiling> _dirTiling;
-    std::vector<TilingOption> _tilingOptions;
+    TilingSearchResult _searchResult;
 };
 
 // Search for tiling options and applies them to prepare hw tilings
@@ -174,12 +200,17 @@ public:
     HWConvolutionTiler() = delete;
     HWConvolutionTiler(const HWConvolutionTiler&) = default;
     HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
+    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, TilingSearchResult searchResult);
 
 
     bool isTilingPossible() const {
         return _tilingPossible;
     }
 
+    const TilingSearchResult& searchResult() const {
+        return _searcher.searchResult();
+    }
+
     bool withPool() const {
         return _convolutionOptions._withPool;
     }
@@ -49,7 +49,7 @@ public:
         _convolutionOptions(other._convolutionOptions),
         _maxTilingOptions(other._maxTilingOptions),
         _dirTiling(PoolGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
-        _tilingOptions(other._tilingOptions) {}
+        _searchResult(other._searchResult) {}
     HWPoolingTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
                             std::size_t maxTilingOptions) :
         _convolutionOptions(std::move(convolutionOptions)),
@@ -57,11 +57,29 @@ public:
         _maxTilingOptions(maxTilingOptions) {
         IE_ASSERT(maxTilingOptions > 0);
         _dirTiling->initTileSizes();
-        _tilingOptions = selectBetterTiling();
+        _searchResult.tilingOptions = selectBetterTiling();
+        _searchResult.inputTileDims = _dirTiling->getInputTileDims();
+        _searchResult.outputTileDims = _dirTiling->getOutputTileDims();
+    }
+
+    // Takes result of the search done before for the same options instead of searching again
+    HWPoolingTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
+                            TilingSearchResult searchResult) :
+        _convolutionOptions(std::move(convolutionOptions)),
+        _maxTilingOptions(searchResult.tilingOptions.size()),
+        _dirTiling(PoolGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
+        _searchResult(std::move(searchResult)) {
+        _dirTiling->initTileSizes();
+        _dirTiling->resetInputTileDims(_searchResult.inputTileDims);
+        _dirTiling->resetOutputTileDims(_searchResult.outputTileDims);
     }
 
     const std::vector<TilingOption>& tilingOptions() const {
-        return _tilingOptions;
+        return _searchResult.tilingOptions;
+    }
+
+    const TilingSearchResult& searchResult() const {
+        return _searchResult;
     }
 
     const ConvolutionOptions& convolutionOptions() const { return _convolutionOptions; }
@@ -74,7 +92,7 @@ private:
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
     const std::unique_ptr<GraphDataTiling> _dirTiling;
-    std::vector<TilingOption> _tilingOptions;
+    TilingSearchResult _searchResult;
 };
 
 // Search for tiling options and applies them to prepare hw tilings
@@ -84,11 +102,16 @@ public:
 
     HWPoolingTiler(const HWPoolingTiler&) = default;
     HWPoolingTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
+    HWPoolingTiler(ConvolutionOptions convolutionOptions, const Direction& direction, TilingSearchResult searchResult);
 
     bool isTilingPossible() const {
         return _tilingPossible;
     }
 
+    const TilingSearchResult& searchResult() const {
+        return _searcher.searchResult();
+    }
+
     const std::vector<HwPoolTilingPtr>& getHwTilings() const {
         return _hwTilings;
     }
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/middleend/hw/tiling.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+//
+// Result of tiling search for a single HW stage
+//
+
+template <class HwTilingPtrT>
+struct TilingDecision final {
+    bool tilingPossible = false;
+    bool withPool = false;
+    std::vector<HwTilingPtrT> hwTilings;
+};
+
+using ConvTilingDecision = TilingDecision<HwConvTilingPtr>;
+using PoolTilingDecision = TilingDecision<HwPoolTilingPtr>;
+
+//
+// Tiling search is a pure function of stage parameters and compilation resources, so decisions are cached
+// by these values and shared between stages of the same shape and between compilations in the process.
+// Cached tilings are immutable, stage tilers only read them.
+// If CompilationConfig::tilingCacheDir is set, search results are also stored there under the same key
+// (stage shape, direction, numCMXSlices and tilingCMXLimit) and reused by compilations in other processes.
+// Decisions kept in memory are also keyed by the cache directory, so each directory gets results of its compilations.
+// Functions are thread safe, they may be called from helper threads bound to CompileEnv.
+//
+
+// Falls back to convolution without merged pooling if the merged one can't be tiled
+std::shared_ptr<const ConvTilingDecision> tileConvolution(
+        const ConvolutionOptions& convolutionOptions,
+        Direction direction,
+        std::size_t maxTilingOptions);
+
+std::shared_ptr<const PoolTilingDecision> tilePooling(
+        const ConvolutionOptions& poolingOptions,
+        Direction direction,
+        std::size_t maxTilingOptions);
+
+// Clears decisions kept in memory, cache directory is left as is
+void clearTilingCache();
+
+//
+// Evaluates tiling search for stages in parallel, helper threads share CompileEnv of the calling thread
+//
+
+template <class Decision, class Search>
+std::vector<std::shared_ptr<const Decision>> findTilings(
+        const std::vector<ConvolutionOptions>& stagesOptions,
+        const Search& search) {
+    const auto& env = CompileEnv::get();
+
+    std::vector<std::shared_ptr<const Decision>> decisions(stagesOptions.size());
+    std::vector<std::exception_ptr> errors(stagesOptions.size());
+
+    InferenceEngine::parallel_for(stagesOptions.size(), [&](size_t stageInd) {
+        CompileEnv::ThreadBinding binding(env);
+        try {
+            decisions[stageInd] = search(stagesOptions[stageInd]);
+        } catch (...) {
+            errors[stageInd] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    return decisions;
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
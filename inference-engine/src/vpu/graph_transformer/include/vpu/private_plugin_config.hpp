@@ -60,6 +60,21 @@ DECLARE_VPU_CONFIG(MYRIAD_CHECK_PREPROCESSING_INSIDE_MODEL);
  */
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM);
 
+/**
+ * @brief Used to enable offline packing of CMX data objects by their lifetimes.
+ * Intermediate data is placed to CMX regions planned for the whole network instead of
+ * greedy allocation in stages order, CMX candidates are prioritized by cost of HW stages using them.
+ * Default is "NO".
+ */
+DECLARE_VPU_CONFIG(MYRIAD_ENABLE_OFFLINE_CMX_PACKING);
+
+/**
+ * @brief Existing directory where results of HW tiling search are stored, keyed by stage shape and CMX resources,
+ * and reused by later compilations in the same or other processes.
+ * Default is empty, results are kept in memory of the process only.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_TILING_CACHE_DIRECTORY);
+
 //
 // Debug options
 //
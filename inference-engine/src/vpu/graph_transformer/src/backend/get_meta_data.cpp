@@ -228,6 +228,7 @@ void BackEnd::getMetaData(
 
     graphMeta.stagesMeta = std::move(stagesMeta);
     graphMeta.datasMeta = std::move(datasMeta);
+    graphMeta.allocationStatistics = model->attrs().getOrDefault<AllocationStatistics>("allocationStatistics", AllocationStatistics());
 }
 
 }  // namespace vpu
@@ -138,6 +138,16 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+CompileEnv::ThreadBinding::ThreadBinding(const CompileEnv& env) : _prevEnv(g_compileEnv) {
+    IE_ASSERT(env.initialized);
+
+    g_compileEnv = const_cast<CompileEnv*>(&env);
+}
+
+CompileEnv::ThreadBinding::~ThreadBinding() {
+    g_compileEnv = _prevEnv;
+}
+
 //
 // compileNetwork
 //
@@ -41,6 +41,47 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     subLbl.appendPair("output", usedMemory.output);
 }
 
+//
+// AllocationStatistics
+//
+
+namespace {
+
+int fragmentationPercent(int peak, int peakLive) {
+    return peak > 0 ? static_cast<int>(100LL * (peak - peakLive) / peak) : 0;
+}
+
+}  // namespace
+
+void printTo(std::ostream& os, const AllocationStatistics& statistics) {
+    os << "[" << std::endl;
+
+    os << "peakCMX=" << statistics.peakCMX << std::endl;
+    os << "peakLiveCMX=" << statistics.peakLiveCMX << std::endl;
+    os << "fragmentationCMX=" << fragmentationPercent(statistics.peakCMX, statistics.peakLiveCMX) << "%" << std::endl;
+    os << "peakDDR=" << statistics.peakDDR << std::endl;
+    os << "peakLiveDDR=" << statistics.peakLiveDDR << std::endl;
+    os << "fragmentationDDR=" << fragmentationPercent(statistics.peakDDR, statistics.peakLiveDDR) << "%" << std::endl;
+    os << "spilledDatas=" << statistics.spilledDatas << std::endl;
+    os << "spilledBytes=" << statistics.spilledBytes << std::endl;
+    os << "plannedDatas=" << statistics.plannedDatas << std::endl;
+    os << "unplannedDatas=" << statistics.unplannedDatas << std::endl;
+
+    os << "]";
+}
+
+void printTo(DotLabel& lbl, const AllocationStatistics& statistics) {
+    DotLabel subLbl(lbl);
+    subLbl.appendPair("peakCMX", statistics.peakCMX);
+    subLbl.appendPair("peakLiveCMX", statistics.peakLiveCMX);
+    subLbl.appendPair("peakDDR", statistics.peakDDR);
+    subLbl.appendPair("peakLiveDDR", statistics.peakLiveDDR);
+    subLbl.appendPair("spilledDatas", statistics.spilledDatas);
+    subLbl.appendPair("spilledBytes", statistics.spilledBytes);
+    subLbl.appendPair("plannedDatas", statistics.plannedDatas);
+    subLbl.appendPair("unplannedDatas", statistics.unplannedDatas);
+}
+
 //
 // Allocator
 //
@@ -278,7 +319,23 @@ bool Allocator::allocateData(const Data& data) {
         "allocateData failed: data {} with usage {} isn't used by anything",
         data->name(), data->usage());
 
-    auto chunk = allocateMem(memoryType, finalByteSize, inUse);
+    allocator::MemChunk* chunk = nullptr;
+
+    if (memoryType == MemoryType::CMX) {
+        const auto planned = _cmxPackingPlan.find(data);
+        if (planned != _cmxPackingPlan.end()) {
+            chunk = allocateMemAt(memoryType, planned->second, finalByteSize, inUse);
+            if (chunk != nullptr) {
+                ++_plannedDatas;
+            } else {
+                ++_unplannedDatas;
+            }
+        }
+    }
+
+    if (chunk == nullptr) {
+        chunk = allocateMem(memoryType, finalByteSize, inUse);
+    }
 
     if (chunk == nullptr) {
         return false;
@@ -465,6 +522,21 @@ UsedMemory Allocator::usedMemoryAmount() const {
     return stats;
 }
 
+AllocationStatistics Allocator::statistics() const {
+    AllocationStatistics statistics;
+
+    statistics.peakCMX = _cmxMemoryPool.memUsed;
+    statistics.peakLiveCMX = _cmxMemoryPool.maxMemLive;
+    statistics.peakDDR = _ddrMemoryPool.memUsed;
+    statistics.peakLiveDDR = _ddrMemoryPool.maxMemLive;
+    statistics.spilledDatas = _spilledDatas;
+    statistics.spilledBytes = _spilledBytes;
+    statistics.plannedDatas = _plannedDatas;
+    statistics.unplannedDatas = _unplannedDatas;
+
+    return statistics;
+}
+
 std::size_t Allocator::freeDDRMemoryAmount() const {
     const auto& pool = _memPools.at(MemoryType::DDR);
     const auto offset = pool->curMemOffset;
@@ -532,7 +604,7 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
     //
 
     if (auto chunk = checkMemPool(*memPool, memType, size, inUse)) {
-        memPool->memUsed = std::max(memPool->memUsed, chunk->offset + chunk->size);
+        updateMemUsage(*memPool, chunk);
         return chunk;
     }
 
@@ -562,16 +634,94 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
 
     memPool->curMemOffset += size;
 
-    memPool->memUsed = std::max(memPool->memUsed, chunk->offset + chunk->size);
+    updateMemUsage(*memPool, chunk);
 
     return chunk;
 }
 
+allocator::MemChunk* Allocator::allocateMemAt(MemoryType memType, int offset, int size, int inUse) {
+    VPU_THROW_UNLESS(size >= 0, "{} bytes to allocate have been requested, but only non-negative amount is supported", size);
+    if (size == 0) {
+        return nullptr;
+    }
+
+    auto& memPool = _memPools.at(memType);
+
+    if (offset >= memPool->curMemOffset) {
+        //
+        // Region is beyond the allocated memory, the gap before it goes to the free pool.
+        // Free pool never has a region adjacent to curMemOffset, so the gap can't be merged with anything.
+        //
+
+        if (static_cast<std::size_t>(offset + size - memPool->curMemOffset) > freeMemoryAmount(memType)) {
+            return nullptr;
+        }
+
+        if (offset > memPool->curMemOffset) {
+            allocator::FreeMemory gap;
+            gap.offset = memPool->curMemOffset;
+            gap.size = offset - memPool->curMemOffset;
+            memPool->freePool.emplace_back(gap);
+        }
+
+        memPool->curMemOffset = offset + size;
+    } else {
+        //
+        // Region must be inside of a single free one, neighbour free regions are always merged
+        //
+
+        const auto freeIt = std::find_if(memPool->freePool.begin(), memPool->freePool.end(),
+            [offset, size](const allocator::FreeMemory& free) {
+                return free.offset <= offset && offset + size <= free.offset + free.size;
+            });
+        if (freeIt == memPool->freePool.end()) {
+            return nullptr;
+        }
+
+        allocator::FreeMemory tail;
+        tail.offset = offset + size;
+        tail.size = freeIt->offset + freeIt->size - tail.offset;
+
+        freeIt->size = offset - freeIt->offset;
+        if (freeIt->size == 0) {
+            memPool->freePool.erase(freeIt);
+        }
+
+        if (tail.size > 0) {
+            memPool->freePool.emplace_back(tail);
+        }
+    }
+
+    int pointer = 0;
+    if (memType == MemoryType::CMX) {
+        IE_ASSERT(offset + size <= _maxCmxSize);
+        pointer = _maxCmxSize - offset - size;
+    } else {
+        pointer = offset;
+    }
+
+    auto chunk = addNewChunk(*memPool, memType, offset, pointer, size, inUse);
+    IE_ASSERT(chunk != nullptr);
+
+    updateMemUsage(*memPool, chunk);
+
+    return chunk;
+}
+
+void Allocator::updateMemUsage(allocator::MemoryPool& memPool, const allocator::MemChunk* chunk) {
+    memPool.memUsed = std::max(memPool.memUsed, chunk->offset + chunk->size);
+
+    memPool.memLive += chunk->size;
+    memPool.maxMemLive = std::max(memPool.maxMemLive, memPool.memLive);
+}
+
 void Allocator::freeMem(allocator::MemChunk* chunk) {
     IE_ASSERT(chunk != nullptr);
 
     auto& memPool =  _memPools.at(chunk->memType);
 
+    memPool->memLive -= chunk->size;
+
     allocator::FreeMemory newMem;
     newMem.offset = chunk->offset;
     newMem.size = chunk->size;
@@ -691,6 +841,9 @@ void Allocator::reset() {
     _allocatedIntermData.clear();
 
     _memChunksPerData.clear();
+
+    _plannedDatas = 0;
+    _unplannedDatas = 0;
 }
 
 AllocationResult Allocator::preprocess(const Model& model) {
@@ -727,6 +880,16 @@ AllocationResult Allocator::preprocess(const Model& model) {
 }
 
 bool Allocator::removeCMXCandidates(const vpu::Data& data) {
+    const auto moveToDDR = [this](const Data& cmxData) {
+        loopOverData(cmxData, [](const Data& subData) {
+            subData->setMemReqs(MemoryType::DDR);
+            return DataLoopStatus::NextChild;
+        });
+
+        ++_spilledDatas;
+        _spilledBytes += calcAllocationSize(cmxData);
+    };
+
     auto it = _candidatesForCMX.find(data);
 
     if (it != _candidatesForCMX.end()) {
@@ -743,10 +906,7 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
             freeData(data, DeallocationMode::MoveFromCMX);
         }
 
-        loopOverData(data, [](const Data& subData) {
-            subData->setMemReqs(MemoryType::DDR);
-            return DataLoopStatus::NextChild;
-        });
+        moveToDDR(data);
 
         _candidatesForCMX.erase(it);
 
@@ -754,6 +914,17 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
     } else {
         auto cmxDatas = getAllocatedDatas(MemoryType::CMX);
 
+        //
+        // Candidates prioritized by cost of their HW consumers are moved to DDR starting from the cheapest one
+        //
+
+        const auto priority = [](const Data& cmxData) {
+            return cmxData->attrs().getOrDefault<float>("CMX-priority", 0.0f);
+        };
+        std::stable_sort(cmxDatas.begin(), cmxDatas.end(), [&priority](const Data& lhs, const Data& rhs) {
+            return priority(lhs) < priority(rhs);
+        });
+
         for (const auto& cmxData : cmxDatas) {
             IE_ASSERT(cmxData->parentDataToDataEdge() == nullptr);
 
@@ -762,10 +933,7 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
             if (it != _candidatesForCMX.end()) {
                 freeData(cmxData, DeallocationMode::MoveFromCMX);
 
-                loopOverData(cmxData, [](const Data& subData) {
-                    subData->setMemReqs(MemoryType::DDR);
-                    return DataLoopStatus::NextChild;
-                });
+                moveToDDR(cmxData);
 
                 _candidatesForCMX.erase(it);
 
@@ -0,0 +1,302 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/allocator/cmx_packing.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <vpu/middleend/allocator/allocator.hpp>
+
+namespace vpu {
+
+//
+// DataLifetime
+//
+
+DataMap<DataLifetime> calcDataLifetimes(const Model& model) {
+    DataMap<DataLifetime> lifetimes;
+
+    const auto extend = [&lifetimes](const Data& data, int stageInd) {
+        const auto topParent = data->getTopParentData();
+        if (topParent->usage() != DataUsage::Intermediate && topParent->usage() != DataUsage::Temp) {
+            return;
+        }
+
+        auto it = lifetimes.find(topParent);
+        if (it == lifetimes.end()) {
+            DataLifetime lifetime;
+            lifetime.begin = stageInd;
+            lifetime.end = stageInd;
+            lifetimes.emplace(topParent, lifetime);
+        } else {
+            it->second.begin = std::min(it->second.begin, stageInd);
+            it->second.end = std::max(it->second.end, stageInd);
+        }
+    };
+
+    //
+    // Follow the order of runAllocator: outputs and temporary buffers are allocated and inputs are released per stage
+    //
+
+    int stageInd = 0;
+    for (const auto& stage : model->getStages()) {
+        for (const auto& output : stage->outputs()) {
+            extend(output, stageInd);
+        }
+        for (const auto& tempBuffer : stage->tempBuffers()) {
+            extend(tempBuffer, stageInd);
+        }
+        for (const auto& input : stage->inputs()) {
+            extend(input, stageInd);
+
+            if (const auto& parentEdge = input->parentDataToShapeEdge()) {
+                extend(parentEdge->parent(), stageInd);
+            }
+        }
+
+        if (stage->type() == StageType::LoopStart) {
+            const auto& loopEnd = stage->attrs().get<Stage>("loop-end");
+            for (const auto& output : loopEnd->outputs()) {
+                extend(output, stageInd);
+            }
+        }
+
+        ++stageInd;
+    }
+
+    for (const auto& data : model->datas()) {
+        if (data->usage() != DataUsage::Input && data->usage() != DataUsage::Output) {
+            continue;
+        }
+
+        if (const auto& parentEdge = data->parentDataToShapeEdge()) {
+            extend(parentEdge->parent(), stageInd);
+        }
+    }
+
+    return lifetimes;
+}
+
+//
+// CMXPackingPlan
+//
+
+namespace {
+
+// Number of following data objects placed in advance to compare candidate offsets of the current one
+constexpr std::size_t kLookaheadDatas = 3;
+
+// Number of the tightest gaps considered as candidate offsets besides the end of the last region
+constexpr std::size_t kCandidateGaps = 3;
+
+struct PackingItem final {
+    Data data;
+    DataLifetime lifetime;
+    int offset = 0;
+    int size = 0;
+};
+
+// Returns offsets of gaps fitting the size between busy regions sorted by offset (the tightest first),
+// the end of the last region is the last offset
+std::vector<int> findOffsets(const std::vector<std::pair<int, int>>& busyRegions, int size, std::size_t maxGaps) {
+    std::vector<std::pair<int, int>> gaps;
+
+    int curOffset = 0;
+    for (const auto& region : busyRegions) {
+        const auto gap = region.first - curOffset;
+        if (gap >= size) {
+            gaps.emplace_back(gap, curOffset);
+        }
+
+        curOffset = std::max(curOffset, region.second);
+    }
+
+    std::stable_sort(gaps.begin(), gaps.end(), [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    std::vector<int> offsets;
+    for (std::size_t gapInd = 0; gapInd < gaps.size() && gapInd < maxGaps; ++gapInd) {
+        offsets.push_back(gaps[gapInd].second);
+    }
+    offsets.push_back(curOffset);
+
+    return offsets;
+}
+
+// Busy regions of the first numPlaced items, which lifetimes intersect the given one, sorted by offset
+void collectBusyRegions(const std::vector<PackingItem>& items, std::size_t numPlaced, const DataLifetime& lifetime,
+                        std::vector<std::pair<int, int>>& busyRegions) {
+    busyRegions.clear();
+    for (std::size_t placedInd = 0; placedInd < numPlaced; ++placedInd) {
+        const auto& placed = items[placedInd];
+        if (placed.lifetime.intersects(lifetime)) {
+            busyRegions.emplace_back(placed.offset, placed.offset + placed.size);
+        }
+    }
+    std::sort(busyRegions.begin(), busyRegions.end());
+}
+
+//
+// Each candidate offset of the current item is evaluated by placing the next lookahead items
+// to their tightest gaps, the offset giving the lowest peak wins. Ties keep the tightest gap.
+//
+
+int selectOffset(std::vector<PackingItem>& items, std::size_t itemInd, int peakSize, std::size_t lookahead,
+                 std::vector<std::pair<int, int>>& busyRegions) {
+    auto& item = items[itemInd];
+
+    collectBusyRegions(items, itemInd, item.lifetime, busyRegions);
+    const auto candidates = findOffsets(busyRegions, item.size, lookahead > 0 ? kCandidateGaps : 1);
+    if (lookahead == 0 || candidates.size() == 1) {
+        return candidates.front();
+    }
+
+    const auto lookaheadEnd = std::min(items.size(), itemInd + 1 + lookahead);
+
+    auto bestOffset = candidates.front();
+    auto bestPeak = std::numeric_limits<int>::max();
+    for (const auto candidate : candidates) {
+        item.offset = candidate;
+        auto peak = std::max(peakSize, item.offset + item.size);
+
+        for (auto nextInd = itemInd + 1; nextInd < lookaheadEnd && peak < bestPeak; ++nextInd) {
+            auto& next = items[nextInd];
+            collectBusyRegions(items, nextInd, next.lifetime, busyRegions);
+            next.offset = findOffsets(busyRegions, next.size, 1).front();
+            peak = std::max(peak, next.offset + next.size);
+        }
+
+        if (peak < bestPeak) {
+            bestPeak = peak;
+            bestOffset = candidate;
+        }
+    }
+
+    return bestOffset;
+}
+
+CMXPackingPlan packInOrder(std::vector<PackingItem>& items, std::size_t lookahead) {
+    CMXPackingPlan plan;
+
+    std::vector<std::pair<int, int>> busyRegions;
+    for (std::size_t itemInd = 0; itemInd < items.size(); ++itemInd) {
+        auto& item = items[itemInd];
+
+        item.offset = selectOffset(items, itemInd, plan.peakSize, lookahead, busyRegions);
+
+        plan.offsets.emplace(item.data, item.offset);
+        plan.peakSize = std::max(plan.peakSize, item.offset + item.size);
+    }
+
+    return plan;
+}
+
+CMXPackingPlan packItems(std::vector<PackingItem>& items) {
+    //
+    // Large long living data objects restrict placement of others the most, so they are placed first.
+    // Lifetime and name make the order stable from run to run.
+    //
+
+    std::sort(items.begin(), items.end(), [](const PackingItem& lhs, const PackingItem& rhs) {
+        if (lhs.size != rhs.size) {
+            return lhs.size > rhs.size;
+        }
+        if (lhs.lifetime.length() != rhs.lifetime.length()) {
+            return lhs.lifetime.length() > rhs.lifetime.length();
+        }
+        if (lhs.lifetime.begin != rhs.lifetime.begin) {
+            return lhs.lifetime.begin < rhs.lifetime.begin;
+        }
+        return lhs.data->name() < rhs.data->name();
+    });
+
+    //
+    // Lookahead is a heuristic too, so plain best fit is taken when it happens to give the lower peak
+    //
+
+    auto plan = packInOrder(items, kLookaheadDatas);
+
+    auto bestFitPlan = packInOrder(items, 0);
+    if (bestFitPlan.peakSize < plan.peakSize) {
+        plan = std::move(bestFitPlan);
+    }
+
+    return plan;
+}
+
+std::vector<PackingItem> collectCMXItems(const DataMap<DataLifetime>& lifetimes) {
+    std::vector<PackingItem> items;
+    for (const auto& p : lifetimes) {
+        if (p.first->memReqs() != MemoryType::CMX) {
+            continue;
+        }
+
+        PackingItem item;
+        item.data = p.first;
+        item.lifetime = p.second;
+        item.size = calcAllocationSize(p.first);
+        items.push_back(item);
+    }
+    return items;
+}
+
+}  // namespace
+
+CMXPackingPlan planCMXPacking(const Model& model) {
+    auto items = collectCMXItems(calcDataLifetimes(model));
+    return packItems(items);
+}
+
+//
+// CMXPacker
+//
+
+CMXPacker::CMXPacker(const Model& model) : _lifetimes(calcDataLifetimes(model)) {
+    auto items = collectCMXItems(_lifetimes);
+    _plan = packItems(items);
+
+    for (const auto& item : items) {
+        _sizes.emplace(item.data, item.size);
+    }
+}
+
+void CMXPacker::add(const Data& data) {
+    const auto lifetime = _lifetimes.find(data);
+    if (lifetime == _lifetimes.end() || _plan.offsets.count(data) != 0) {
+        return;
+    }
+
+    std::vector<std::pair<int, int>> busyRegions;
+    for (const auto& placed : _plan.offsets) {
+        if (_lifetimes.at(placed.first).intersects(lifetime->second)) {
+            busyRegions.emplace_back(placed.second, placed.second + _sizes.at(placed.first));
+        }
+    }
+    std::sort(busyRegions.begin(), busyRegions.end());
+
+    const auto size = calcAllocationSize(data);
+    const auto offset = findOffsets(busyRegions, size, 1).front();
+
+    _plan.offsets.emplace(data, offset);
+    _sizes.emplace(data, size);
+    _plan.peakSize = std::max(_plan.peakSize, offset + size);
+}
+
+void CMXPacker::remove(const Data& data) {
+    if (_plan.offsets.erase(data) == 0) {
+        return;
+    }
+    _sizes.erase(data);
+
+    _plan.peakSize = 0;
+    for (const auto& placed : _plan.offsets) {
+        _plan.peakSize = std::max(_plan.peakSize, placed.second + _sizes.at(placed.first));
+    }
+}
+
+}  // namespace vpu
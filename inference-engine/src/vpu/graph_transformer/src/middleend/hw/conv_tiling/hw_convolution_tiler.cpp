@@ -263,6 +263,13 @@ HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, co
     _tilingPossible = tileForHW();
 }
 
+HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                       TilingSearchResult searchResult) :
+    _convolutionOptions(std::move(convolutionOptions)),
+    _searcher(_convolutionOptions, direction, std::move(searchResult)) {
+    _tilingPossible = tileForHW();
+}
+
 bool HWConvolutionTiler::tileForHW() {
     const auto& tilingOptions = _searcher.tilingOptions();
     if (tilingOptions.empty()) {
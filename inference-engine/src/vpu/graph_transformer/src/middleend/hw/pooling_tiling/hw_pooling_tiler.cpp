@@ -254,6 +254,13 @@ HWPoolingTiler::HWPoolingTiler(ConvolutionOptions convolutionOptions, const Dire
     _tilingPossible = tileForHW();
 }
 
+HWPoolingTiler::HWPoolingTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
+                               TilingSearchResult searchResult) :
+    _convolutionOptions(std::move(convolutionOptions)),
+    _searcher(_convolutionOptions, direction, std::move(searchResult)) {
+    _tilingPossible = tileForHW();
+}
+
 bool HWPoolingTiler::tileForHW() {
     const std::vector<TilingOption>& tilingOptions = _searcher.tilingOptions();
     if (tilingOptions.empty()) {
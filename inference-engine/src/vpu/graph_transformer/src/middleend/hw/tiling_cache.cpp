@@ -0,0 +1,278 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/tiling_cache.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+namespace {
+
+// Bounds memory of long living processes compiling many different networks
+constexpr std::size_t maxCachedDecisions = 16 * 1024;
+
+template <class Decision>
+class DecisionCache final {
+public:
+    template <class Search>
+    std::shared_ptr<const Decision> getOrSearch(const std::string& key, const Search& search) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _decisions.find(key);
+            if (it != _decisions.end()) {
+                return it->second;
+            }
+        }
+
+        // Search runs unlocked, the same key evaluated concurrently gives the same decision
+        std::shared_ptr<const Decision> decision = std::make_shared<Decision>(search());
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_decisions.size() >= maxCachedDecisions) {
+            _decisions.clear();
+        }
+        return _decisions.emplace(key, std::move(decision)).first->second;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _decisions.clear();
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::shared_ptr<const Decision>> _decisions;
+};
+
+DecisionCache<ConvTilingDecision>& convDecisions() {
+    static DecisionCache<ConvTilingDecision> cache;
+    return cache;
+}
+
+DecisionCache<PoolTilingDecision>& poolDecisions() {
+    static DecisionCache<PoolTilingDecision> cache;
+    return cache;
+}
+
+// Stage name only appears in error messages, so it is not a part of the key
+std::string makeKey(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    const auto& resources = CompileEnv::get().resources;
+
+    std::ostringstream key;
+    printTo(key, options._inputDims);
+    printTo(key, options._outputDims);
+    printTo(key, options._origOutputDims);
+    key << options._kernelSizeX << ' ' << options._kernelSizeY << ' ' << options._kernelStride << ' '
+        << options._paddingLeft << ' ' << options._paddingRight << ' '
+        << options._paddingTop << ' ' << options._paddingBottom << ' '
+        << options._withPool << ' ' << static_cast<int>(direction) << ' ' << maxTilingOptions << ' '
+        << resources.numCMXSlices << ' ' << resources.tilingCMXLimit;
+    return key.str();
+}
+
+// Decisions are stored to the cache directory when they are searched, so decisions kept in memory
+// are separated by the directory the compilation uses
+std::string makeDecisionKey(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    return CompileEnv::get().config.tilingCacheDir + '\n' + makeKey(options, direction, maxTilingOptions);
+}
+
+//
+// Search results stored in cache directory, one text file per key:
+//   header line, key line, tiling options count, tiling options, input and output tile dims.
+// The full key is stored and compared, file name is only its hash.
+//
+
+constexpr char cacheFileHeader[] = "VPU_HW_TILING_SEARCH 1";
+
+std::string cacheFilePath(const std::string& cacheDir, const std::string& key) {
+    std::ostringstream path;
+    path << cacheDir << "/hw_tiling_" << std::hex << std::setw(16) << std::setfill('0')
+         << std::hash<std::string>()(key) << ".txt";
+    return path.str();
+}
+
+void writeDims(std::ostream& stream, const DimValues& dims) {
+    stream << dims.size();
+    for (const auto& dim : dims) {
+        stream << ' ' << static_cast<int>(dim.first) << ' ' << dim.second;
+    }
+    stream << '\n';
+}
+
+bool readDims(std::istream& stream, DimValues& dims) {
+    std::size_t size = 0;
+    if (!(stream >> size) || size > MAX_DIMS_64) {
+        return false;
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+        int dim = 0, value = 0;
+        if (!(stream >> dim >> value) || dim < 0 || dim >= MAX_DIMS_64) {
+            return false;
+        }
+        dims.set(static_cast<Dim>(dim), value);
+    }
+    return true;
+}
+
+// Missing or unreadable file is a cache miss
+bool loadSearchResult(const std::string& path, const std::string& key, std::size_t maxTilingOptions,
+                      TilingSearchResult& result) {
+    std::ifstream file(path);
+    std::string header, storedKey;
+    if (!std::getline(file, header) || header != cacheFileHeader ||
+        !std::getline(file, storedKey) || storedKey != key) {
+        return false;
+    }
+
+    std::size_t numOptions = 0;
+    if (!(file >> numOptions) || numOptions > maxTilingOptions) {
+        return false;
+    }
+    result.tilingOptions.resize(numOptions);
+    for (auto& option : result.tilingOptions) {
+        if (!(file >> option.numWidthTiles >> option.numHeightTiles >> option.numChannelTiles
+                   >> option.totalNumTiles >> option.cost)) {
+            return false;
+        }
+    }
+
+    return readDims(file, result.inputTileDims) && readDims(file, result.outputTileDims);
+}
+
+// File is written aside and renamed, so concurrent compilations never read partially written result.
+// Failure to store only means the search is repeated next time.
+void storeSearchResult(const std::string& path, const std::string& key, const TilingSearchResult& result) {
+    std::ostringstream tmpPath;
+    tmpPath << path << '.' << std::hash<std::thread::id>()(std::this_thread::get_id()) << '.' << std::random_device()() << ".tmp";
+
+    {
+        std::ofstream file(tmpPath.str());
+        file << cacheFileHeader << '\n' << key << '\n' << result.tilingOptions.size() << '\n';
+        file << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (const auto& option : result.tilingOptions) {
+            file << option.numWidthTiles << ' ' << option.numHeightTiles << ' ' << option.numChannelTiles << ' '
+                 << option.totalNumTiles << ' ' << option.cost << '\n';
+        }
+        writeDims(file, result.inputTileDims);
+        writeDims(file, result.outputTileDims);
+        if (!file.good()) {
+            file.close();
+            std::remove(tmpPath.str().c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmpPath.str().c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.str().c_str());
+    }
+}
+
+// Search result is read from cache directory if it is set and has the result, otherwise it is stored there
+template <class Tiler, class Decision, class Use>
+Decision withTiler(const char* kind, const ConvolutionOptions& options, Direction direction,
+                   std::size_t maxTilingOptions, const Use& use) {
+    const auto& cacheDir = CompileEnv::get().config.tilingCacheDir;
+    if (cacheDir.empty()) {
+        const Tiler tiler(options, direction, maxTilingOptions);
+        return use(tiler);
+    }
+
+    const auto key = std::string(kind) + ' ' + makeKey(options, direction, maxTilingOptions);
+    const auto path = cacheFilePath(cacheDir, key);
+
+    TilingSearchResult stored;
+    if (loadSearchResult(path, key, maxTilingOptions, stored)) {
+        const Tiler tiler(options, direction, std::move(stored));
+        return use(tiler);
+    }
+
+    const Tiler tiler(options, direction, maxTilingOptions);
+    storeSearchResult(path, key, tiler.searchResult());
+    return use(tiler);
+}
+
+template <class Decision, class Tiler>
+Decision makeDecision(const Tiler& tiler, bool withPool) {
+    Decision decision;
+    decision.tilingPossible = tiler.isTilingPossible();
+    decision.withPool = withPool;
+    decision.hwTilings = tiler.getHwTilings();
+    return decision;
+}
+
+}  // namespace
+
+std::shared_ptr<const ConvTilingDecision> tileConvolution(
+        const ConvolutionOptions& convolutionOptions,
+        Direction direction,
+        std::size_t maxTilingOptions) {
+    const auto makeConvDecision = [](const HWConvolutionTiler& tiler) {
+        return makeDecision<ConvTilingDecision>(tiler, tiler.withPool());
+    };
+
+    return convDecisions().getOrSearch(makeDecisionKey(convolutionOptions, direction, maxTilingOptions), [&] {
+        auto decision1stAttempt = withTiler<HWConvolutionTiler, ConvTilingDecision>(
+            "conv", convolutionOptions, direction, maxTilingOptions, makeConvDecision);
+        if (decision1stAttempt.tilingPossible || !decision1stAttempt.withPool) {
+            return decision1stAttempt;
+        }
+
+        const auto optionsWithoutPool = ConvolutionOptions{
+            convolutionOptions._stageName,
+            convolutionOptions._inputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._kernelSizeX,
+            convolutionOptions._kernelSizeY,
+            convolutionOptions._kernelStride,
+            convolutionOptions._paddingLeft,
+            convolutionOptions._paddingRight,
+            convolutionOptions._paddingTop,
+            convolutionOptions._paddingBottom,
+            false
+        };
+
+        return withTiler<HWConvolutionTiler, ConvTilingDecision>(
+            "conv", optionsWithoutPool, direction, maxTilingOptions, makeConvDecision);
+    });
+}
+
+std::shared_ptr<const PoolTilingDecision> tilePooling(
+        const ConvolutionOptions& poolingOptions,
+        Direction direction,
+        std::size_t maxTilingOptions) {
+    return poolDecisions().getOrSearch(makeDecisionKey(poolingOptions, direction, maxTilingOptions), [&] {
+        return withTiler<HWPoolingTiler, PoolTilingDecision>(
+            "pool", poolingOptions, direction, maxTilingOptions, [](const HWPoolingTiler& tiler) {
+                return makeDecision<PoolTilingDecision>(tiler, false);
+            });
+    });
+}
+
+void clearTilingCache() {
+    convDecisions().clear();
+    poolDecisions().clear();
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
@@ -12,6 +12,7 @@
 
 #include <vpu/compile_env.hpp>
 #include <vpu/middleend/allocator/allocator.hpp>
+#include <vpu/middleend/allocator/cmx_packing.hpp>
 #include <vpu/middleend/hw/utility.hpp>
 
 namespace vpu {
@@ -382,6 +383,56 @@ void PassImpl::copyHwMisalignedInput(const Model& model) {
     }
 }
 
+//
+// Prioritize CMX candidates by cost of HW stages using them
+//
+
+//
+// HW stages are bound by memory traffic, so the cost of a stage is the amount of data it reads and writes.
+// CMX is shared in time, so the cost is divided by the area (size by lifetime) the candidate occupies in CMX.
+// Allocator moves candidates with the lowest priority to DDR first.
+//
+
+void prioritizeCmxCandidates(const DataMap<DataLifetime>& lifetimes, DataVector& candidates) {
+    const auto& env = CompileEnv::get();
+
+    const auto stageCost = [](const Stage& stage) {
+        float cost = 0.0f;
+        for (const auto& input : stage->inputs()) {
+            cost += static_cast<float>(input->totalByteSize());
+        }
+        for (const auto& output : stage->outputs()) {
+            cost += static_cast<float>(output->totalByteSize());
+        }
+        return cost;
+    };
+
+    for (const auto& candidate : candidates) {
+        float hwCost = 0.0f;
+        loopOverData(candidate, [&hwCost, &stageCost](const Data& subData) {
+            for (const auto& consumer : subData->consumers()) {
+                if (consumer->category() == StageCategory::HW) {
+                    hwCost += stageCost(consumer);
+                }
+            }
+            return DataLoopStatus::NextChild;
+        });
+
+        const auto lifetime = lifetimes.find(candidate);
+        const auto length = lifetime != lifetimes.end() ? lifetime->second.length() : 1;
+        const auto area = static_cast<float>(calcAllocationSize(candidate)) * static_cast<float>(length);
+
+        const auto priority = area > 0.0f ? hwCost / area : 0.0f;
+        candidate->attrs().set<float>("CMX-priority", priority);
+
+        env.log->trace("CMX priority of Data [%s] : %f", candidate->name(), priority);
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Data& lhs, const Data& rhs) {
+        return lhs->attrs().get<float>("CMX-priority") > rhs->attrs().get<float>("CMX-priority");
+    });
+}
+
 //
 // Try to put HW inputs to CMX if possible
 //
@@ -400,7 +451,7 @@ void PassImpl::packDataInCmx(const Model& model) {
     // Collect candidates
     //
 
-    std::queue<Data> candidatesForCMX;
+    DataVector candidates;
 
     auto& visitedDatas = allocator.getCandidatesForCMX();
     visitedDatas.clear();
@@ -429,13 +480,29 @@ void PassImpl::packDataInCmx(const Model& model) {
 
             if (producer->getSHAVEsRequirements() != StageSHAVEsRequirements::NeedMax) {
                 if (visitedDatas.count(topParent) == 0) {
-                    candidatesForCMX.push(topParent);
+                    candidates.push_back(topParent);
                     visitedDatas.insert(topParent);
                 }
             }
         }
     }
 
+    //
+    // Stages order doesn't change while candidates are tried, so CMX packing is planned once
+    // and only the current candidate is added to the plan
+    //
+
+    std::unique_ptr<CMXPacker> cmxPacker;
+    if (env.config.enableOfflineCmxPacking) {
+        cmxPacker.reset(new CMXPacker(model));
+        prioritizeCmxCandidates(cmxPacker->lifetimes(), candidates);
+    }
+
+    std::queue<Data> candidatesForCMX;
+    for (const auto& candidate : candidates) {
+        candidatesForCMX.push(candidate);
+    }
+
     //
     // Try candidates one by one -> if allocation cycle is successfull, leave the data in CMX
     //
@@ -458,12 +525,22 @@ void PassImpl::packDataInCmx(const Model& model) {
             return DataLoopStatus::NextChild;
         });
 
-        auto allocRes = runAllocator(model, EnableShapeAllocation::NO, CheckOnlyCMX::YES);
+        AllocationResult allocRes;
+        if (cmxPacker != nullptr) {
+            cmxPacker->add(curCandidate);
+            allocRes = runAllocator(model, cmxPacker->plan(), EnableShapeAllocation::NO, CheckOnlyCMX::YES);
+        } else {
+            allocRes = runAllocator(model, EnableShapeAllocation::NO, CheckOnlyCMX::YES);
+        }
         env.log->trace("Allocation result : %v", allocRes.status);
 
         if (allocRes.status != AllocationStatus::OK) {
             env.log->trace("Revert CMX usage for Data [%s]", curCandidate->name());
 
+            if (cmxPacker != nullptr) {
+                cmxPacker->remove(curCandidate);
+            }
+
             loopOverData(curCandidate, [](const Data& subData) {
                 subData->setMemReqs(MemoryType::DDR);
                 return DataLoopStatus::NextChild;
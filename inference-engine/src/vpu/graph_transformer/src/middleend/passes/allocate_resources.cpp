@@ -14,8 +14,10 @@
 #include <set>
 #include <queue>
 #include <memory>
+#include <utility>
 
 #include <vpu/middleend/allocator/allocator.hpp>
+#include <vpu/middleend/allocator/cmx_packing.hpp>
 #include <vpu/compile_env.hpp>
 #include <vpu/utils/auto_scope.hpp>
 
@@ -25,9 +27,9 @@ namespace vpu {
 // runAllocator
 //
 
-AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableShapeAllocation, CheckOnlyCMX checkOnlyCmx) {
-    VPU_PROFILE(runAllocator);
+namespace {
 
+AllocationResult allocateInStagesOrder(const Model& model, EnableShapeAllocation enableShapeAllocation, CheckOnlyCMX checkOnlyCmx) {
     auto& allocator = model->getAllocator();
 
     //
@@ -93,7 +95,8 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
                 }
 
                 if (!allocator.allocateData(output)) {
-                    if (output->memReqs() == MemoryType::CMX && checkOnlyCmx == CheckOnlyCMX::NO) {
+                    // CMX candidates are not moved to DDR while the packing plan is tried, there is a fallback without it
+                    if (output->memReqs() == MemoryType::CMX && checkOnlyCmx == CheckOnlyCMX::NO && !allocator.hasCMXPackingPlan()) {
                         if (allocator.removeCMXCandidates(output)) {
                             if (allocator.allocateData(output)) {
                                 continue;
@@ -245,6 +248,47 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
     return AllocationResult();
 }
 
+}  // namespace
+
+AllocationResult runAllocator(const Model& model, const CMXPackingPlan& plan, EnableShapeAllocation enableShapeAllocation,
+                              CheckOnlyCMX checkOnlyCmx) {
+    VPU_PROFILE(runAllocator);
+
+    const auto& env = CompileEnv::get();
+
+    auto& allocator = model->getAllocator();
+
+    if (!plan.offsets.empty() && plan.peakSize <= env.resources.numCMXSlices * CMX_SLICE_SIZE) {
+        allocator.setCMXPackingPlan(plan.offsets);
+        AutoScope scope([&allocator]() {
+            allocator.setCMXPackingPlan({});
+        });
+
+        const auto result = allocateInStagesOrder(model, enableShapeAllocation, checkOnlyCmx);
+        if (result.status == AllocationStatus::OK) {
+            return result;
+        }
+    }
+
+    return allocateInStagesOrder(model, enableShapeAllocation, checkOnlyCmx);
+}
+
+AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableShapeAllocation, CheckOnlyCMX checkOnlyCmx) {
+    const auto& env = CompileEnv::get();
+
+    //
+    // Try offline CMX packing first, greedy allocation in stages order is the fallback.
+    //
+
+    if (env.config.enableOfflineCmxPacking) {
+        return runAllocator(model, planCMXPacking(model), enableShapeAllocation, checkOnlyCmx);
+    }
+
+    VPU_PROFILE(runAllocator);
+
+    return allocateInStagesOrder(model, enableShapeAllocation, checkOnlyCmx);
+}
+
 //
 // allocateResources
 //
@@ -279,6 +323,10 @@ void PassImpl::run(const Model& model) {
     //
 
     model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemoryAmount());
+    model->attrs().set<AllocationStatistics>("allocationStatistics", allocator.statistics());
+
+    const auto& env = CompileEnv::get();
+    env.log->info("Allocation statistics : %v", allocator.statistics());
 }
 
 }  // namespace
@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -16,6 +17,7 @@
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
 
 namespace vpu {
 
@@ -34,6 +36,14 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    //
+    // Tiling of every stage depends only on its own parameters,
+    // so it's evaluated for all stages in parallel before the model is changed
+    //
+
+    StageVector hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> hwStagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -47,19 +57,8 @@ void PassImpl::run(const Model& model) {
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        hwStagesOptions.emplace_back(
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -71,40 +70,35 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+            stageOptions.withPool);
+    }
+
+    //
+    // Try to find "best" tiling
+    //
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const auto decisions = HWTilingNS::findTilings<HWTilingNS::ConvTilingDecision>(
+        hwStagesOptions,
+        [&](const HWTilingNS::ConvolutionOptions& options) {
+            return HWTilingNS::tileConvolution(options, direction, tilingsCount);
+        });
+
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& decision = *decisions[stageInd];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
         //
 
-        if (!tiler.isTilingPossible()) {
+        if (!decision.tilingPossible) {
             origStage->attrs().set<bool>("tryHW", false);
 
             auto swConvOutput = stageIO.origOutput;
@@ -182,7 +176,7 @@ void PassImpl::run(const Model& model) {
 
         model->disconnectStage(origStage);
 
-        for (const auto &tiling : tiler.getHwTilings()) {
+        for (const auto &tiling : decision.hwTilings) {
             HWConvStageTiler hwStageTiler(
                 stageOptions,
                 stageIO,
@@ -190,7 +184,7 @@ void PassImpl::run(const Model& model) {
                 origStage,
                 _stageBuilder,
                 tiling,
-                stageOptions.withPool && !tiler.withPool());
+                stageOptions.withPool && !decision.withPool);
 
             //
             // Split/concat input/output tiles
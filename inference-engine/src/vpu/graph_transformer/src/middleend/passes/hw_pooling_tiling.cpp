@@ -9,11 +9,13 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
 
 namespace vpu {
 
@@ -32,6 +34,14 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    //
+    // Tiling of every stage depends only on its own parameters,
+    // so it's evaluated for all stages in parallel before the model is changed
+    //
+
+    StageVector hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> hwStagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -46,16 +56,8 @@ void PassImpl::run(const Model& model) {
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        hwStagesOptions.emplace_back(
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -67,11 +69,32 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false);
+    }
 
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+    //
+    // Try to find "best" tiling
+    //
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const auto decisions = HWTilingNS::findTilings<HWTilingNS::PoolTilingDecision>(
+        hwStagesOptions,
+        [&](const HWTilingNS::ConvolutionOptions& options) {
+            return HWTilingNS::tilePooling(options, direction, tilingsCount);
+        });
+
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& decision = *decisions[stageInd];
+
+        const HWPoolStageOptions stageOptions(origStage);
+        const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        if (!tiler.isTilingPossible()) {
+        if (!decision.tilingPossible) {
             origStage->attrs().set<bool>("tryHW", false);
 
             auto swOutput = stageIO.origOutput;
@@ -100,7 +123,7 @@ void PassImpl::run(const Model& model) {
         model->disconnectStage(origStage);
 
 
-        for (const auto &tiling : tiler.getHwTilings()) {
+        for (const auto &tiling : decision.hwTilings) {
             HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, tiling);
             //
             // Split/concat input/output tiles
@@ -71,6 +71,8 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_CHECK_PREPROCESSING_INSIDE_MODEL,
         ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION,
         ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM,
+        ie::MYRIAD_ENABLE_OFFLINE_CMX_PACKING,
+        ie::MYRIAD_TILING_CACHE_DIRECTORY,
 
         //
         // Debug options
@@ -190,8 +192,10 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.checkPreprocessingInsideModel,  switches, config, ie::MYRIAD_CHECK_PREPROCESSING_INSIDE_MODEL);
     setOption(_compileConfig.enableEarlyEltwiseReLUFusion,   switches, config, ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION);
     setOption(_compileConfig.enableCustomReshapeParam,       switches, config, ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM);
+    setOption(_compileConfig.enableOfflineCmxPacking,        switches, config, ie::MYRIAD_ENABLE_OFFLINE_CMX_PACKING);
 
     setOption(_compileConfig.irWithVpuScalesDir,                       config, ie::MYRIAD_IR_WITH_SCALES_DIRECTORY);
+    setOption(_compileConfig.tilingCacheDir,                           config, ie::MYRIAD_TILING_CACHE_DIRECTORY);
     setOption(_compileConfig.noneLayers,                               config, ie::MYRIAD_NONE_LAYERS, parseStringSet);
     setOption(_compileConfig.hwWhiteList,                              config, ie::MYRIAD_HW_WHITE_LIST, parseStringSet);
     setOption(_compileConfig.hwBlackList,                              config, ie::MYRIAD_HW_BLACK_LIST, parseStringSet);
@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <openvino/itt.hpp>
+
+namespace {
+
+OV_ITT_DOMAIN(itt_trace_tests);
+
+using Task = openvino::itt::ScopedTask<itt_trace_tests>;
+
+struct ThreadTrace {
+    std::string name;
+    std::map<std::string, size_t> tasks;    // number of begins of each task
+    size_t ends = 0;
+    bool balanced = true;                   // every end has a preceding begin, and all tasks are ended
+    size_t depth = 0;
+};
+
+std::string field(const std::string& line, const std::string& key) {
+    const auto prefix = "\"" + key + "\":";
+    const auto pos = line.find(prefix);
+    if (pos == std::string::npos)
+        return {};
+    auto begin = pos + prefix.size();
+    if (line[begin] == '"')
+        return line.substr(begin + 1, line.find('"', begin + 1) - begin - 1);
+    return line.substr(begin, line.find_first_of(",}", begin) - begin);
+}
+
+// Each event is written on its own line
+std::map<std::string, ThreadTrace> readTrace(const std::string& path) {
+    std::map<std::string, ThreadTrace> threads;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto ph = field(line, "ph");
+        if (ph.empty())
+            continue;
+        auto& thread = threads[field(line, "tid")];
+        if (ph == "M") {
+            thread.name = field(line.substr(line.find("\"args\"")), "name");
+        } else if (ph == "B") {
+            thread.tasks[field(line, "name")]++;
+            thread.depth++;
+        } else if (ph == "E") {
+            thread.ends++;
+            if (thread.depth == 0)
+                thread.balanced = false;
+            else
+                thread.depth--;
+        }
+    }
+    for (auto& thread : threads) {
+        if (thread.second.depth != 0)
+            thread.second.balanced = false;
+    }
+    return threads;
+}
+
+const ThreadTrace* findThread(const std::map<std::string, ThreadTrace>& threads, const std::string& name) {
+    for (const auto& thread : threads) {
+        if (thread.second.name == name)
+            return &thread.second;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+class TraceCollectorTests : public ::testing::Test {
+protected:
+    std::string tracePath = ::testing::UnitTest::GetInstance()->current_test_info()->name() + std::string(".json");
+
+    void SetUp() override {
+        openvino::itt::startTracing();
+        if (!openvino::itt::dumpTrace(tracePath))
+            GTEST_SKIP() << "The trace collector isn't built in (ENABLE_PROFILING_TRACE is OFF)";
+    }
+
+    void TearDown() override {
+        std::remove(tracePath.c_str());
+    }
+};
+
+TEST_F(TraceCollectorTests, recordsTasksAfterStart) {
+    std::thread worker([] {
+        openvino::itt::threadName("trace_test_record");
+        Task outer(openvino::itt::handle("trace_test_outer"));
+        for (int i = 0; i < 3; i++) {
+            Task inner(openvino::itt::handle("trace_test_inner"));
+        }
+    });
+    worker.join();
+
+    ASSERT_TRUE(openvino::itt::dumpTrace(tracePath));
+    const auto threads = readTrace(tracePath);
+    const auto thread = findThread(threads, "trace_test_record");
+    ASSERT_NE(nullptr, thread);
+    ASSERT_TRUE(thread->balanced);
+    ASSERT_EQ(1u, thread->tasks.at("trace_test_outer"));
+    ASSERT_EQ(3u, thread->tasks.at("trace_test_inner"));
+    ASSERT_EQ(4u, thread->ends);
+}
+
+TEST_F(TraceCollectorTests, dumpFailsForInvalidPath) {
+    ASSERT_FALSE(openvino::itt::dumpTrace("not_existing_directory/trace.json"));
+}
+
+TEST_F(TraceCollectorTests, unfinishedTasksAreNotDumped) {
+    ASSERT_TRUE(openvino::itt::dumpTrace(tracePath));
+    {
+        Task running(openvino::itt::handle("trace_test_running"));
+        ASSERT_TRUE(openvino::itt::dumpTrace(tracePath));
+    }
+
+    for (const auto& thread : readTrace(tracePath)) {
+        ASSERT_TRUE(thread.second.balanced) << thread.second.name;
+        ASSERT_EQ(0u, thread.second.tasks.count("trace_test_running")) << thread.second.name;
+    }
+}
+
+TEST_F(TraceCollectorTests, wraparoundKeepsOnlyCompleteTasks) {
+    // begin of the outer task is overwritten if the ring buffer is smaller than the number of events
+    size_t bufferSize = 1 << 16;
+    if (const char* size = std::getenv("OPENVINO_TRACE_BUFFER_SIZE"))
+        bufferSize = std::max<size_t>(bufferSize, std::strtoul(size, nullptr, 10));
+    const size_t innerTasks = bufferSize;
+
+    std::thread worker([&] {
+        openvino::itt::threadName("trace_test_wraparound");
+        Task outer(openvino::itt::handle("trace_test_outer"));
+        for (size_t i = 0; i < innerTasks; i++) {
+            Task inner(openvino::itt::handle("trace_test_inner"));
+        }
+    });
+    worker.join();
+
+    ASSERT_TRUE(openvino::itt::dumpTrace(tracePath));
+    const auto threads = readTrace(tracePath);
+    const auto thread = findThread(threads, "trace_test_wraparound");
+    ASSERT_NE(nullptr, thread);
+    ASSERT_TRUE(thread->balanced);
+    ASSERT_EQ(0u, thread->tasks.count("trace_test_outer"));
+    ASSERT_LT(0u, thread->tasks.at("trace_test_inner"));
+    ASSERT_GT(innerTasks, thread->tasks.at("trace_test_inner"));
+}
+
+TEST_F(TraceCollectorTests, tasksOfMultipleThreadsAreSeparated) {
+    const size_t threadsNum = 4;
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threadsNum; t++) {
+        workers.emplace_back([t] {
+            openvino::itt::threadName("trace_test_thread_" + std::to_string(t));
+            for (size_t i = 0; i <= t; i++) {
+                Task task(openvino::itt::handle("trace_test_task"));
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    ASSERT_TRUE(openvino::itt::dumpTrace(tracePath));
+    const auto threads = readTrace(tracePath);
+    for (size_t t = 0; t < threadsNum; t++) {
+        const auto thread = findThread(threads, "trace_test_thread_" + std::to_string(t));
+        ASSERT_NE(nullptr, thread) << t;
+        ASSERT_TRUE(thread->balanced) << t;
+        ASSERT_EQ(t + 1, thread->tasks.at("trace_test_task")) << t;
+    }
+}
@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <legacy/ie_util_internal.hpp>
+#include <ngraph/op/constant.hpp>
 #include "ngraph_reader_tests.hpp"
 
 using namespace InferenceEngine;
@@ -95,3 +98,57 @@ TEST_F(NGraphReaderTests, ReadConstantNetworkWithNegativeDimension) {
 
     EXPECT_THROW(ie.ReadNetwork(model, weights),  std::exception);
 }
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkSharesWeights) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant" type="Const" version="opset1">
+            <data element_type="f32" offset="16" shape="2,2" size="16"/>
+            <output>
+                <port id="0" precision="FP32" names="constant_tensor">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights;
+
+    weights = make_shared_blob<float>(TensorDesc(Precision::FP32, {8}, Layout::C));
+    weights->allocate();
+    std::fill_n(weights->buffer().as<float*>(), 8, 1.f);
+
+    auto network = ie.ReadNetwork(model, weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::shared_ptr<ngraph::op::v0::Constant> constant;
+    for (const auto& op : function->get_ops()) {
+        if (auto c = std::dynamic_pointer_cast<ngraph::op::v0::Constant>(op)) {
+            constant = c;
+        }
+    }
+    ASSERT_NE(nullptr, constant);
+    EXPECT_EQ("constant", constant->get_friendly_name());
+    EXPECT_EQ(ngraph::element::f32, constant->get_element_type());
+    EXPECT_EQ(ngraph::Shape({2, 2}), constant->get_shape());
+    EXPECT_EQ(std::unordered_set<std::string>{"constant_tensor"}, constant->get_output_tensor(0).get_names());
+    EXPECT_EQ(weights->cbuffer().as<const float*>() + 4, constant->get_data_ptr<float>());
+    EXPECT_TRUE(constant->get_all_data_elements_bitwise_identical());
+}
@@ -82,4 +82,55 @@ const auto params5Inputs = ::testing::Combine(
 
 INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput5In, DetectionOutputLayerTest, params5Inputs, DetectionOutputLayerTest::getTestCaseName);
 
+/* =============== top_k smaller than the number of candidates =============== */
+
+const auto topKAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(backgroundLabelId),
+        ::testing::Values(1, 7),
+        ::testing::ValuesIn(keepTopK),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(0.0f),
+        ::testing::Values(false),
+        ::testing::Values(false),
+        ::testing::Values(true)
+);
+
+const auto paramsTopK = ::testing::Combine(
+        topKAttributes,
+        ::testing::ValuesIn(specificParams3In),
+        ::testing::ValuesIn(numberBatch),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputTopK, DetectionOutputLayerTest, paramsTopK, DetectionOutputLayerTest::getTestCaseName);
+
+/* =============== MXNet NMS with nonzero background label =============== */
+
+const auto mxNetAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(1),
+        ::testing::ValuesIn(topK),
+        ::testing::ValuesIn(keepTopK),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(confidenceThreshold),
+        ::testing::Values(false),
+        ::testing::Values(false),
+        ::testing::Values(true)
+);
+
+const auto paramsMxNetBackground = ::testing::Combine(
+        mxNetAttributes,
+        ::testing::ValuesIn(specificParams3In),
+        ::testing::ValuesIn(numberBatch),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputMxNetBackground, DetectionOutputLayerTest, paramsMxNetBackground,
+                        DetectionOutputLayerTest::getTestCaseName);
+
 }  // namespace
@@ -40,3 +40,29 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// Enough boxes for the parallel sort of candidates and for vectorized IoU against many kept boxes,
+// per-class limits from a single box up to more boxes than pass the score threshold
+const std::vector<InputShapeParams> largeInShapeParams = {
+    InputShapeParams{1, 5000, 2},
+    InputShapeParams{2, 1000, 3}
+};
+
+const std::vector<int32_t> largeMaxOutBoxPerClass = {1, 17, 600};
+const std::vector<float> largeScoreThreshold = {0.0f, 0.95f};
+
+const auto nmsLargeParams = ::testing::Combine(::testing::ValuesIn(largeInShapeParams),
+                                               ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                  ::testing::Values(Precision::I32),
+                                                                  ::testing::Values(Precision::FP32)),
+                                               ::testing::ValuesIn(largeMaxOutBoxPerClass),
+                                               ::testing::Values(0.5f),
+                                               ::testing::ValuesIn(largeScoreThreshold),
+                                               ::testing::ValuesIn(sigmaThreshold),
+                                               ::testing::Values(op::v5::NonMaxSuppression::BoxEncodingType::CORNER),
+                                               ::testing::Values(true),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest_LargeInput, NmsLayerTest, nmsLargeParams, NmsLayerTest::getTestCaseName);
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const std::vector<float> meanValues = {-5.f, -10.f, -20.f};
+const size_t netHeight = 32, netWidth = 32;
+
+/* Mean values of an U8 input with resize are subtracted by the pre-processing graph, which writes
+   FP32 data directly into the graph input. Without mean values, or with a mean image, pre-processing
+   only resizes the input and the plugin converts and normalizes it, which is the unfused path.
+
+     Parameter[FP32, 1x3x32x32]
+              |
+            Relu
+              |
+     Output[FP32]
+*/
+std::shared_ptr<ngraph::Function> makeFunction() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32,
+                                                             ngraph::Shape{1, meanValues.size(), netHeight, netWidth});
+    param->set_friendly_name("param");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    relu->set_friendly_name("relu");
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                              ngraph::ParameterVector{param});
+}
+
+std::vector<float> infer(CNNNetwork& cnnNet, const Blob::Ptr& input) {
+    auto& inputInfo = cnnNet.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    inputInfo->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+
+    Core ie;
+    auto req = ie.LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    req.SetBlob(inputInfo->name(), input);
+    req.Infer();
+
+    auto output = as<MemoryBlob>(req.GetBlob(cnnNet.getOutputsInfo().begin()->first));
+    auto outputMem = output->rmap();
+    const auto* data = outputMem.as<const float*>();
+    return std::vector<float>(data, data + output->size());
+}
+
+}  // namespace
+
+TEST(PreprocessingNormalizationTest, smoke_FusedMeanValuesMatchPluginPath_CPU) {
+    // the input is larger than the network's one, so it is resized before the mean subtraction
+    const auto input = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U8, {1, meanValues.size(), 45, 61}, Layout::NHWC),
+                                                        255);
+
+    // fused: resize, mean subtraction and conversion to FP32 in one pass
+    CNNNetwork fusedNet(makeFunction());
+    auto& fusedPreProcess = fusedNet.getInputsInfo().begin()->second->getPreProcess();
+    fusedPreProcess.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        fusedPreProcess[c]->meanValue = meanValues[c];
+        fusedPreProcess[c]->stdScale = 1.f;
+    }
+    fusedPreProcess.setVariant(MEAN_VALUE);
+    const auto fused = infer(fusedNet, input);
+
+    // unfused: resize only, the input is non-negative, so it passes Relu as is
+    CNNNetwork resizeNet(makeFunction());
+    const auto resized = infer(resizeNet, input);
+
+    // unfused: the same mean values subtracted by the plugin as a mean image
+    CNNNetwork meanImageNet(makeFunction());
+    auto& preProcess = meanImageNet.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        preProcess[c]->meanData = make_blob_with_precision(TensorDesc(Precision::FP32, {netHeight, netWidth}, Layout::HW));
+        preProcess[c]->meanData->allocate();
+        auto meanMem = as<MemoryBlob>(preProcess[c]->meanData)->wmap();
+        std::fill_n(meanMem.as<float*>(), netHeight * netWidth, meanValues[c]);
+    }
+    preProcess.setVariant(MEAN_IMAGE);
+    const auto meanImage = infer(meanImageNet, input);
+
+    ASSERT_EQ(fused.size(), resized.size());
+    ASSERT_EQ(fused.size(), meanImage.size());
+    for (size_t i = 0; i < fused.size(); i++) {
+        const auto channel = i / (netHeight * netWidth) % meanValues.size();
+        ASSERT_NEAR(resized[i] - meanValues[channel], fused[i], 1e-5f) << i;
+        ASSERT_NEAR(meanImage[i], fused[i], 1e-5f) << i;
+    }
+}
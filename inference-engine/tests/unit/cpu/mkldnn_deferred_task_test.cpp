@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "utils/deferred_task.hpp"
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(DeferredTaskTest, RunOnDemandExecutesOnce) {
+    int count = 0;
+    DeferredTask task([&] { ++count; });
+    task.run();
+    task.run();
+    ASSERT_EQ(1, count);
+}
+
+TEST(DeferredTaskTest, ConcurrentRunsExecuteOnceAndWaitForCompletion) {
+    std::atomic<int> count{0};
+    std::atomic<bool> done{false};
+    DeferredTask task([&] {
+        ++count;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        done = true;
+    });
+
+    // a background worker and several inferences need the task at the same time
+    std::vector<std::thread> threads;
+    std::atomic<int> completedBeforeReturn{0};
+    for (int i = 0; i < 8; i++) {
+        threads.emplace_back([&] {
+            task.run();
+            if (done)
+                ++completedBeforeReturn;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1, count);
+    ASSERT_EQ(8, completedBeforeReturn);
+}
+
+TEST(DeferredTaskTest, CancelPreventsExecution) {
+    int count = 0;
+    DeferredTask task([&] { ++count; });
+    task.cancel();
+    task.run();
+    ASSERT_EQ(0, count);
+}
+
+TEST(DeferredTaskTest, CancelWaitsForRunningTask) {
+    std::atomic<bool> started{false};
+    std::atomic<bool> done{false};
+    DeferredTask task([&] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        done = true;
+    });
+
+    std::thread worker([&] { task.run(); });
+    while (!started)
+        std::this_thread::yield();
+    task.cancel();
+    ASSERT_TRUE(done);
+    worker.join();
+}
+
+TEST(DeferredTaskTest, NotCancellableTaskIsExecutedAfterCancel) {
+    int count = 0;
+    DeferredTask task([&] { ++count; }, false);
+    task.cancel();
+    task.run();
+    ASSERT_EQ(1, count);
+}
+
+TEST(DeferredTaskTest, FailedTaskIsRetried) {
+    int count = 0;
+    DeferredTask task([&] {
+        if (++count == 1)
+            throw std::runtime_error("failure");
+    });
+    ASSERT_THROW(task.run(), std::runtime_error);
+    ASSERT_NO_THROW(task.run());
+    ASSERT_EQ(2, count);
+}
+
+TEST(DeferredTaskTest, SharedWeightsAreFilledWhenOneUserCancels) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    int filled = 0;
+    auto create = [&] { return std::make_shared<MKLDNNMemory>(eng); };
+    auto init = [&] (MKLDNNMemory&) { ++filled; };
+
+    auto first = cache.findOrCreate("weights", create, true, init);
+    MKLDNNMemoryPtr firstMemory = *first;
+    auto second = cache.findOrCreate("weights", create, true, init);
+    MKLDNNMemoryPtr secondMemory = *second;
+    ASSERT_EQ(firstMemory, secondMemory);
+    ASSERT_EQ(first->getInitTask(), second->getInitTask());
+
+    // the graph of the first user is destroyed before the weights are repacked
+    first->getInitTask()->cancel();
+    first.reset();
+    firstMemory.reset();
+
+    second->getInitTask()->run();
+    ASSERT_EQ(1, filled);
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "ie_parallel.hpp"
+#include "utils/hw_perf_counters.hpp"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+void measure(HwPerfCount& count) {
+    HwPerfHelper helper(&count);
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < 100000; i++)
+        sum += i;
+}
+
+bool anyAvailable(const HwPerfCount& count) {
+    for (size_t i = 0; i < HwCountersNum; i++) {
+        if (count.isAvailable(static_cast<HwCounter>(i)))
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(HwPerfCountersTest, NoStatisticsIsNoop) {
+    ASSERT_NO_THROW(HwPerfHelper helper(nullptr));
+}
+
+// Passes whether perf_event is permitted in the environment or not
+TEST(HwPerfCountersTest, CountsOrSkipsExecution) {
+    HwPerfCount count;
+    measure(count);
+
+    HwCounterValues values;
+    if (HwPerfCounters::forCurrentThread().read(values)) {
+        ASSERT_EQ(1u, count.count());
+        ASSERT_TRUE(anyAvailable(count));
+        if (count.isAvailable(HwCounter::Instructions)) {
+            ASSERT_LT(0u, count.avg(HwCounter::Instructions));
+        }
+    } else {
+        ASSERT_EQ(0u, count.count());
+        ASSERT_FALSE(anyAvailable(count));
+        for (auto value : values)
+            ASSERT_EQ(0u, value);
+    }
+}
+
+// The instructions which workers execute for the node are counted as well
+TEST(HwPerfCountersTest, CountsWorkOfParallelWorkers) {
+    const uint64_t iterations = 10000000;
+    const int threads = parallel_get_max_threads();
+    HwPerfCount parallel;
+    {
+        HwPerfHelper helper(&parallel);
+        InferenceEngine::parallel_nt(threads, [&](const int, const int) {
+            volatile uint64_t sum = 0;
+            for (uint64_t i = 0; i < iterations; i++)
+                sum += i;
+        });
+    }
+
+    if (!parallel.isAvailable(HwCounter::Instructions))
+        return;
+    // every iteration is several instructions
+    ASSERT_LE(iterations * threads, parallel.avg(HwCounter::Instructions));
+}
+
+#ifdef __linux__
+TEST(HwPerfCountersTest, UnavailablePerfEventIsIgnored) {
+    // no file descriptors can be opened, so perf_event_open fails in a new thread, which opens its own group
+    rlimit limit;
+    ASSERT_EQ(0, getrlimit(RLIMIT_NOFILE, &limit));
+    rlimit noFiles = limit;
+    noFiles.rlim_cur = 0;
+    ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &noFiles));
+
+    HwPerfCount count;
+    bool read = true;
+    std::thread worker([&] {
+        measure(count);
+        HwCounterValues values;
+        read = HwPerfCounters::forCurrentThread().read(values);
+    });
+    worker.join();
+    ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &limit));
+
+    ASSERT_FALSE(read);
+    ASSERT_EQ(0u, count.count());
+    ASSERT_FALSE(anyAvailable(count));
+    for (size_t i = 0; i < HwCountersNum; i++)
+        ASSERT_EQ(0u, count.avg(static_cast<HwCounter>(i)));
+}
+#endif
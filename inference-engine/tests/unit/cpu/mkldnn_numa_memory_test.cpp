@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "utils/numa_memory.hpp"
+#include "mkldnn_weights_cache.hpp"
+#include <ie_system_conf.h>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+uint64_t totalUsage() {
+    uint64_t total = 0;
+    for (auto& usage : getNumaMemoryUsage())
+        total += usage.second;
+    return total;
+}
+
+class FakeNumaTopology : public NumaTopology {
+public:
+    struct BindCall {
+        void* ptr;
+        size_t size;
+        NumaPolicy policy;
+        std::vector<int> nodes;
+    };
+
+    std::vector<int> nodes() const override {
+        return {0, 1, 2, 3};
+    }
+
+    void bind(void* ptr, size_t size, NumaPolicy policy, const std::vector<int>& nodes) const override {
+        calls.push_back({ptr, size, policy, nodes});
+    }
+
+    mutable std::vector<BindCall> calls;
+};
+
+class FakeNumaTopologyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        topology = std::make_shared<FakeNumaTopology>();
+        setNumaTopology(topology);
+    }
+
+    void TearDown() override {
+        setNumaTopology(nullptr);
+    }
+
+    std::shared_ptr<FakeNumaTopology> topology;
+};
+
+}  // namespace
+
+TEST(NumaMemoryTest, AllocatedMemoryIsAlignedAndWritable) {
+    const int node = InferenceEngine::getAvailableNUMANodes().front();
+    for (auto policy : {NumaPolicy::None, NumaPolicy::Bind, NumaPolicy::Interleave}) {
+        for (size_t size : {size_t(1), size_t(1000), size_t(1 << 20)}) {
+            auto data = allocateNumaMemory(size, {policy, node});
+            ASSERT_NE(nullptr, data.get());
+            ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data.get()) % 64);
+            std::memset(data.get(), 0x5A, size);
+            ASSERT_EQ(0x5A, static_cast<unsigned char*>(data.get())[size - 1]);
+        }
+    }
+}
+
+TEST(NumaMemoryTest, BytesAreAccountedToTargetNode) {
+    const int node = InferenceEngine::getAvailableNUMANodes().back();
+    const size_t size = 3 << 20;
+    const uint64_t before = getNumaMemoryUsage()[node];
+    {
+        auto data = allocateNumaMemory(size, {NumaPolicy::Bind, node});
+        ASSERT_EQ(before + size, getNumaMemoryUsage()[node]);
+    }
+    ASSERT_EQ(before, getNumaMemoryUsage()[node]);
+}
+
+TEST(NumaMemoryTest, InterleavedBytesAreSplitBetweenNodes) {
+    const auto nodes = InferenceEngine::getAvailableNUMANodes();
+    const size_t size = (1 << 20) + 3;
+    const uint64_t before = totalUsage();
+    {
+        auto data = allocateNumaMemory(size, {NumaPolicy::Interleave, 0});
+        ASSERT_EQ(before + size, totalUsage());
+        for (auto node : nodes)
+            ASSERT_LE(size / nodes.size(), getNumaMemoryUsage()[node]);
+    }
+    ASSERT_EQ(before, totalUsage());
+}
+
+TEST_F(FakeNumaTopologyTest, BoundMemoryIsPlacedOnTargetNode) {
+    const size_t size = 1 << 20;
+    for (int node : topology->nodes()) {
+        const uint64_t before = getNumaMemoryUsage()[node];
+        auto data = allocateNumaMemory(size, {NumaPolicy::Bind, node});
+#if defined(__linux__)
+        ASSERT_EQ(1u, topology->calls.size());
+        ASSERT_EQ(data.get(), topology->calls.front().ptr);
+        ASSERT_EQ(size, topology->calls.front().size);
+        ASSERT_EQ(NumaPolicy::Bind, topology->calls.front().policy);
+        ASSERT_EQ(std::vector<int>{node}, topology->calls.front().nodes);
+#endif
+        ASSERT_EQ(before + size, getNumaMemoryUsage()[node]);
+        topology->calls.clear();
+    }
+}
+
+TEST_F(FakeNumaTopologyTest, InterleavedMemoryIsSpreadOverAllNodes) {
+    const size_t size = (1 << 20) + 2;
+    auto before = getNumaMemoryUsage();
+    auto data = allocateNumaMemory(size, {NumaPolicy::Interleave, 0});
+#if defined(__linux__)
+    ASSERT_EQ(1u, topology->calls.size());
+    ASSERT_EQ(NumaPolicy::Interleave, topology->calls.front().policy);
+    ASSERT_EQ(topology->nodes(), topology->calls.front().nodes);
+#endif
+    auto after = getNumaMemoryUsage();
+    for (int node : topology->nodes())
+        ASSERT_EQ(before[node] + size / 4 + (node < 2 ? 1 : 0), after[node]) << node;
+}
+
+TEST_F(FakeNumaTopologyTest, DefaultAndSmallAllocationsAreNotBound) {
+    const uint64_t before = getNumaMemoryUsage()[2];
+    auto data = allocateNumaMemory(1 << 20, {NumaPolicy::None, 2});
+    auto small = allocateNumaMemory(100, {NumaPolicy::Bind, 2});
+    ASSERT_TRUE(topology->calls.empty());
+    ASSERT_EQ(before + (1 << 20) + 100, getNumaMemoryUsage()[2]);
+}
+
+TEST_F(FakeNumaTopologyTest, WeightsCachesArePerNode) {
+    NumaNodesWeights weights;
+    for (int node : topology->nodes()) {
+        for (auto policy : {NumaPolicy::None, NumaPolicy::Bind}) {
+            const auto& placement = weights.get(node, policy)->getPlacement();
+            ASSERT_EQ(policy, placement.policy);
+            ASSERT_EQ(node, placement.node);
+        }
+        ASSERT_NE(weights.get(node, NumaPolicy::Bind), weights.get(node, NumaPolicy::None));
+        ASSERT_EQ(weights.get(0, NumaPolicy::Interleave), weights.get(node, NumaPolicy::Interleave));
+    }
+    ASSERT_THROW(weights.get(4, NumaPolicy::Bind), InferenceEngine::Exception);
+}
+
+TEST_F(FakeNumaTopologyTest, WeightsAreAllocatedOnNodeOfCache) {
+    NumaNodesWeights weights;
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    const mkldnn::memory::desc desc({256, 1024}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nc);
+
+    for (int node : topology->nodes()) {
+        auto before = getNumaMemoryUsage();
+        MKLDNNMemory memory(eng);
+        memory.Create(desc, weights.get(node, NumaPolicy::Bind)->getPlacement());
+        auto after = getNumaMemoryUsage();
+        for (int other : topology->nodes())
+            ASSERT_EQ(before[other] + (other == node ? desc.get_size() : 0), after[other]) << node << " " << other;
+#if defined(__linux__)
+        ASSERT_EQ(std::vector<int>{node}, topology->calls.back().nodes);
+#endif
+    }
+}
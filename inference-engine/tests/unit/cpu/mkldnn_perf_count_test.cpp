@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// bucket of the largest duration
+const int kLastBucket = (64 - PerfCount::kSubBucketsLog2 + 1) * PerfCount::kSubBuckets - 1;
+
+}  // namespace
+
+TEST(PerfCountTest, SmallDurationsHaveExactBuckets) {
+    for (uint64_t ns = 0; ns < PerfCount::kSubBuckets * 2; ns++) {
+        ASSERT_EQ(static_cast<int>(ns), PerfCount::bucket(ns));
+        ASSERT_EQ(ns, PerfCount::bucketLow(PerfCount::bucket(ns)));
+    }
+}
+
+TEST(PerfCountTest, BucketsSplitOctaves) {
+    ASSERT_EQ(16, PerfCount::bucket(16));
+    ASSERT_EQ(16, PerfCount::bucket(17));
+    ASSERT_EQ(17, PerfCount::bucket(18));
+    ASSERT_EQ(23, PerfCount::bucket(31));
+    ASSERT_EQ(24, PerfCount::bucket(32));
+    ASSERT_EQ(kLastBucket, PerfCount::bucket(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(PerfCountTest, BucketRangesAreContiguous) {
+    for (int b = 0; b < kLastBucket; b++) {
+        const uint64_t low = PerfCount::bucketLow(b);
+        const uint64_t next = PerfCount::bucketLow(b + 1);
+        ASSERT_LT(low, next) << b;
+        ASSERT_EQ(b, PerfCount::bucket(low)) << b;
+        ASSERT_EQ(b, PerfCount::bucket(next - 1)) << b;
+        // the width of a bucket is at most 1 / kSubBuckets of its values
+        ASSERT_LE((next - low) * PerfCount::kSubBuckets, std::max<uint64_t>(low, PerfCount::kSubBuckets)) << b;
+    }
+}
+
+TEST(PerfCountTest, EmptyCounter) {
+    PerfCount counter;
+    ASSERT_EQ(0u, counter.count());
+    ASSERT_EQ(0u, counter.avg_ns());
+    ASSERT_EQ(0u, counter.max_ns());
+    ASSERT_EQ(0u, counter.percentile_ns(0.5));
+}
+
+TEST(PerfCountTest, AverageAndMax) {
+    PerfCount counter;
+    counter.add(1000);
+    counter.add(3000);
+    counter.add(5000);
+    ASSERT_EQ(3u, counter.count());
+    ASSERT_EQ(3000u, counter.avg_ns());
+    ASSERT_EQ(3u, counter.avg());
+    ASSERT_EQ(5000u, counter.max_ns());
+}
+
+TEST(PerfCountTest, PercentileDoesNotExceedMax) {
+    // 960 is the lowest value of its bucket, the middle of the bucket would be 992
+    PerfCount counter;
+    counter.add(960);
+    ASSERT_EQ(960u, counter.percentile_ns(0.5));
+    ASSERT_EQ(960u, counter.percentile_ns(1.0));
+}
+
+TEST(PerfCountTest, PercentilesAreWithinBucketPrecision) {
+    PerfCount counter;
+    std::vector<uint64_t> samples;
+    for (uint64_t i = 1; i <= 1000; i++)
+        samples.push_back(i * i * 37 % 1000003 + 100);
+    for (auto ns : samples)
+        counter.add(ns);
+    std::sort(samples.begin(), samples.end());
+
+    for (double p : {0.01, 0.5, 0.9, 0.99, 1.0}) {
+        const uint64_t exact = samples[static_cast<size_t>(p * samples.size() + 0.5) - 1];
+        const double estimated = static_cast<double>(counter.percentile_ns(p));
+        ASSERT_LE(std::fabs(estimated - exact), exact / static_cast<double>(PerfCount::kSubBuckets)) << p;
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+uint64_t hashString(const std::string& str) {
+    return MKLDNNWeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+}
+
+}  // namespace
+
+// Published XXH64 test vectors (seed 0)
+TEST(WeightsHashTest, KnownAnswers) {
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, hashString(""));
+    ASSERT_EQ(0xD24EC4F1A98C6E5BULL, hashString("a"));
+    ASSERT_EQ(0x44BC2CF5AD770999ULL, hashString("abc"));
+    ASSERT_EQ(0xFBCEA83C8A378BF1ULL, hashString("Nobody inspects the spammish repetition"));
+    ASSERT_EQ(0x0B242D361FDA71BCULL, hashString("The quick brown fox jumps over the lazy dog"));
+}
+
+TEST(WeightsHashTest, KnownAnswerOfSeveralStripes) {
+    std::string data;
+    for (int i = 0; i < 5 * 256; i++)
+        data.push_back(static_cast<char>(i % 256));
+    ASSERT_EQ(0xAFC184AD7938A354ULL, hashString(data));
+}
+
+TEST(WeightsHashTest, ChunkedHashDependsOnEveryChunk) {
+    std::vector<unsigned char> data((3 << 20) + 5, 0x5A);
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    const uint64_t reference = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(reference, hashFunc.hash(data.data(), data.size()));
+
+    for (size_t offset : {size_t(0), size_t(1 << 20), data.size() - 1}) {
+        data[offset] ^= 1;
+        ASSERT_NE(reference, hashFunc.hash(data.data(), data.size())) << offset;
+        data[offset] ^= 1;
+    }
+    ASSERT_NE(reference, hashFunc.hash(data.data(), data.size() - 1));
+}
@@ -0,0 +1,229 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ie_system_conf.h>
+
+#include "backend/dnn_types.h"
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#ifdef HAVE_AVX2
+#include "runtime/cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512F
+#include "runtime/cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace {
+
+struct FloatKernels {
+    std::string name;
+    float (*sdot)(const float *X, const float *Y, uint32_t N);
+    void (*saxpy)(float alpha, const float *X, float *Y, uint32_t N);
+    void (*smax)(const float *X, float *Y, uint32_t N);
+};
+
+// the kernels selected for the host and every ISA implementation the host can run
+std::vector<FloatKernels> kernelsToTest() {
+    std::vector<FloatKernels> kernels{{"dispatched", sdot, saxpy, smax}};
+#ifdef HAVE_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        namespace isa = GNAPluginNS::runtime::avx2;
+        kernels.push_back({"avx2", isa::sdot, isa::saxpy, isa::smax});
+    }
+#endif
+#ifdef HAVE_AVX512F
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        namespace isa = GNAPluginNS::runtime::avx512;
+        kernels.push_back({"avx512", isa::sdot, isa::saxpy, isa::smax});
+    }
+#endif
+    return kernels;
+}
+
+// lengths around vector widths and unrolled loops of the kernels, so every tail is covered
+const std::vector<uint32_t> lengths = {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 63, 64, 65, 129, 1001};
+
+std::vector<float> random(size_t size, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> values(size);
+    for (auto& value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+// accumulation order of vectorized kernels differs from the scalar one
+float tolerance(float magnitude) {
+    return 1e-5f * std::max(1.f, magnitude);
+}
+
+}  // namespace
+
+TEST(GNAFloatRuntimeTest, sdotMatchesScalarOnAllLengths) {
+    std::mt19937 generator(3);
+    for (const auto& kernels : kernelsToTest()) {
+        for (auto N : lengths) {
+            // one more element, so the unaligned pointers are tested as well
+            const auto X = random(N + 1, generator);
+            const auto Y = random(N + 1, generator);
+            double expected = 0, magnitude = 0;
+            for (uint32_t i = 0; i < N; i++) {
+                expected += static_cast<double>(X[i + 1]) * Y[i + 1];
+                magnitude += std::fabs(static_cast<double>(X[i + 1]) * Y[i + 1]);
+            }
+            EXPECT_NEAR(expected, kernels.sdot(X.data() + 1, Y.data() + 1, N), tolerance(magnitude))
+                << kernels.name << " N=" << N;
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, saxpyMatchesScalarOnAllLengths) {
+    std::mt19937 generator(5);
+    const float alpha = 0.75f;
+    for (const auto& kernels : kernelsToTest()) {
+        for (auto N : lengths) {
+            const auto X = random(N + 1, generator);
+            auto Y = random(N + 2, generator);
+            const auto expected = Y;
+            kernels.saxpy(alpha, X.data() + 1, Y.data() + 1, N);
+            for (uint32_t i = 0; i < N; i++) {
+                EXPECT_NEAR(expected[i + 1] + alpha * X[i + 1], Y[i + 1], tolerance(0)) << kernels.name << " N=" << N;
+            }
+            // elements past the end are not touched
+            EXPECT_EQ(expected[N + 1], Y[N + 1]) << kernels.name << " N=" << N;
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, smaxMatchesScalarOnAllLengths) {
+    std::mt19937 generator(7);
+    for (const auto& kernels : kernelsToTest()) {
+        for (auto N : lengths) {
+            const auto X = random(N + 1, generator);
+            auto Y = random(N + 2, generator);
+            const auto expected = Y;
+            kernels.smax(X.data() + 1, Y.data() + 1, N);
+            for (uint32_t i = 0; i < N; i++) {
+                EXPECT_EQ(std::max(expected[i + 1], X[i + 1]), Y[i + 1]) << kernels.name << " N=" << N;
+            }
+            EXPECT_EQ(expected[N + 1], Y[N + 1]) << kernels.name << " N=" << N;
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, sgemmMatchesScalar) {
+    std::mt19937 generator(11);
+    for (auto K : {1, 7, 17, 65}) {
+        for (auto transB : {CblasNoTrans, CblasTrans}) {
+            const int M = 5, N = 3;
+            // leading dimensions are larger than the rows, so strided access is covered
+            const int lda = K + 1, ldb = (transB == CblasNoTrans) ? N + 2 : K + 3, ldc = N + 1;
+            const auto A = random(static_cast<size_t>(M) * lda, generator);
+            const auto B = random(static_cast<size_t>((transB == CblasNoTrans) ? K : N) * ldb, generator);
+            auto C = random(static_cast<size_t>(M) * ldc, generator);
+            const auto C0 = C;
+
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, transB, M, N, K, 1.0f, A.data(), lda, B.data(), ldb, 1.0f,
+                         C.data(), ldc);
+
+            for (int i = 0; i < M; i++) {
+                for (int j = 0; j < N; j++) {
+                    double expected = C0[i * ldc + j];
+                    for (int k = 0; k < K; k++) {
+                        const float b = (transB == CblasNoTrans) ? B[k * ldb + j] : B[j * ldb + k];
+                        expected += static_cast<double>(A[i * lda + k]) * b;
+                    }
+                    EXPECT_NEAR(expected, C[i * ldc + j], tolerance(K)) << "K=" << K << " transB=" << transB;
+                }
+            }
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, convolutionMatchesScalar) {
+    std::mt19937 generator(13);
+    // odd numbers of coefficients leave tails in every dot product
+    for (uint32_t maps : {1u, 3u, 8u}) {
+        intel_dnn_component_t component{};
+        auto& conv = component.op.conv1D;
+        conv.num_filters = 5;
+        conv.num_feature_maps = maps;
+        conv.num_feature_map_columns = 3;
+        conv.num_feature_map_rows = 11;
+        conv.num_filter_rows = 3;
+        conv.num_filter_coefficients = conv.num_filter_rows * maps * conv.num_feature_map_columns;
+
+        const uint32_t stride = maps * conv.num_feature_map_columns;
+        const uint32_t num_outputs = conv.num_feature_map_rows - conv.num_filter_rows + 1;
+        auto inputs = random(conv.num_feature_map_rows * stride, generator);
+        auto filters = random(conv.num_filters * conv.num_filter_coefficients, generator);
+        auto biases = random(conv.num_filters, generator);
+        std::vector<float> outputs(num_outputs * conv.num_filters);
+
+        conv.ptr_filters = filters.data();
+        conv.ptr_biases = biases.data();
+        component.num_rows_in = 1;
+        component.num_rows_out = 1;
+        component.num_columns_out = static_cast<uint32_t>(outputs.size());
+        component.ptr_inputs = inputs.data();
+        component.ptr_outputs = outputs.data();
+        component.original_layer_name = "conv";
+
+        CNNFilter32(&component);
+
+        for (uint32_t j = 0; j < num_outputs; j++) {
+            for (uint32_t i = 0; i < conv.num_filters; i++) {
+                double expected = biases[i];
+                const float* filter = filters.data() + i * conv.num_filter_coefficients;
+                for (uint32_t k = 0; k < conv.num_filter_coefficients; k++) {
+                    expected += static_cast<double>(inputs[j * stride + k]) * filter[k];
+                }
+                EXPECT_NEAR(expected, outputs[j * conv.num_filters + i], tolerance(conv.num_filter_coefficients))
+                    << "maps=" << maps << " output=" << j << " filter=" << i;
+            }
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, poolingMatchesScalar) {
+    std::mt19937 generator(17);
+    // the number of channels is a vector length of pooling, the last window is partial
+    for (uint32_t channels : {1u, 9u, 17u, 33u}) {
+        for (bool sum : {false, true}) {
+            const uint32_t rows = 11, window = 3;
+            const uint32_t num_outputs = (rows + window - 1) / window;
+            auto inputs = random(rows * channels, generator);
+            std::vector<float> outputs(num_outputs * channels);
+
+            intel_dnn_component_t component{};
+            component.op.maxpool.inCHW = {channels, rows, 1};
+            component.op.maxpool.poolingWindowXY = {window, 1};
+            component.op.maxpool.poolingStrideXY = {window, 1};
+            component.ptr_inputs = inputs.data();
+            component.ptr_outputs = outputs.data();
+
+            CNNMaxPool(&component, kDnnFloat, sum);
+
+            for (uint32_t m = 0; m < num_outputs; m++) {
+                for (uint32_t c = 0; c < channels; c++) {
+                    float expected = sum ? 0.f : -1e20f;
+                    for (uint32_t k = m * window; k < std::min(rows, (m + 1) * window); k++) {
+                        const float value = inputs[k * channels + c];
+                        expected = sum ? expected + value : std::max(expected, value);
+                    }
+                    EXPECT_NEAR(expected, outputs[m * channels + c], tolerance(window))
+                        << "channels=" << channels << " sum=" << sum << " output=" << m;
+                }
+            }
+        }
+    }
+}
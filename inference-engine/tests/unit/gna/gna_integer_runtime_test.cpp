@@ -0,0 +1,129 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "backend/gna_types.h"
+#include "runtime/gna_integer_runtime.hpp"
+#include "runtime/intmath.h"
+#include "runtime/pwl.h"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+template <typename T>
+std::vector<T> random(size_t size, std::mt19937& generator) {
+    std::uniform_int_distribution<int32_t> distribution(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    std::vector<T> values(size);
+    for (auto& value : values) {
+        value = static_cast<T>(distribution(generator));
+    }
+    return values;
+}
+
+int64_t clamp32(int64_t value) {
+    return std::max<int64_t>(std::min<int64_t>(value, std::numeric_limits<int32_t>::max()),
+                             std::numeric_limits<int32_t>::min());
+}
+
+}  // namespace
+
+TEST(GNAIntegerRuntimeTest, dotProductsAreExact) {
+    std::mt19937 generator(7);
+    for (uint32_t N : {0u, 1u, 15u, 16u, 33u, 257u, 5000u}) {
+        auto W16 = random<int16_t>(N, generator);
+        auto W8 = random<int8_t>(N, generator);
+        auto X = random<int16_t>(N, generator);
+        int64_t expected16 = 0, expected8 = 0;
+        for (uint32_t i = 0; i < N; i++) {
+            expected16 += static_cast<int64_t>(W16[i]) * X[i];
+            expected8 += static_cast<int64_t>(W8[i]) * X[i];
+        }
+        EXPECT_EQ(idot16(W16.data(), X.data(), N), expected16) << N;
+        EXPECT_EQ(idot8(W8.data(), X.data(), N), expected8) << N;
+    }
+
+    // pairs of the largest products don't fit 32 bits
+    std::vector<int16_t> min16(64, std::numeric_limits<int16_t>::min());
+    EXPECT_EQ(idot16(min16.data(), min16.data(), 64), INT64_C(64) * 32768 * 32768);
+}
+
+TEST(GNAIntegerRuntimeTest, affineWithCompoundBiasSaturates) {
+    std::mt19937 generator(11);
+    const uint32_t M = 21, K = 70, N = 3;
+    auto weights = random<int8_t>(M * K, generator);
+    auto inputs = random<int16_t>(K * N, generator);
+    std::vector<gna_compound_bias_t> biases(M);
+    for (auto& bias : biases) {
+        bias.bias = static_cast<int32_t>(generator() >> 8);
+        bias.multiplier = static_cast<uint8_t>(generator());
+    }
+    std::vector<int32_t> outputs(M * N);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = K;
+    component.num_columns_in = N;
+    component.num_rows_out = M;
+    component.num_columns_out = N;
+    component.num_bytes_per_input = 2;
+    component.num_bytes_per_output = 4;
+    component.op.affine.num_bytes_per_weight = 1;
+    component.op.affine.num_bytes_per_bias = sizeof(gna_compound_bias_t);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    Integer::ApplyAffineTransform(&component, nullptr, 0);
+
+    uint32_t num_saturated = 0;
+    for (uint32_t i = 0; i < M; i++) {
+        for (uint32_t j = 0; j < N; j++) {
+            int64_t sum = 0;
+            for (uint32_t k = 0; k < K; k++) {
+                sum += static_cast<int64_t>(weights[i * K + k]) * biases[i].multiplier * inputs[k * N + j];
+            }
+            sum += biases[i].bias;
+            num_saturated += clamp32(sum) != sum;
+            EXPECT_EQ(outputs[i * N + j], clamp32(sum));
+        }
+    }
+    EXPECT_GT(num_saturated, 0u);
+}
+
+TEST(GNAIntegerRuntimeTest, piecewiseLinearUsesSlopeScale) {
+    std::vector<gna_pwl_segment_t> segments(3);
+    segments[0].xBase = static_cast<int32_t>(INT32_MIN & XBASEMASK);
+    segments[0].yBase = -32768;
+    segments[0].slope = 0;
+    segments[1].xBase = -1000;
+    segments[1].yBase = -100;
+    segments[1].slope = 512;  // 2.0 scaled by 2^8
+    segments[2].xBase = 1000 | 1;
+    segments[2].yBase = 1900;
+    segments[2].slope = 5;  // scaled by 2^16
+
+    std::vector<int32_t> inputs = {-5000, -1000, -999, 0, 1000, 100000000};
+    std::vector<int16_t> outputs(inputs.size());
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_columns_in = static_cast<uint32_t>(inputs.size());
+    component.num_rows_out = 1;
+    component.num_columns_out = component.num_columns_in;
+    component.num_bytes_per_input = 4;
+    component.num_bytes_per_output = 2;
+    component.orientation_in = kDnnNonInterleavedOrientation;
+    component.op.pwl.num_segments = static_cast<uint32_t>(segments.size());
+    component.op.pwl.ptr_segments = segments.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    Integer::ApplyPiecewiseLinearTransform(&component, component.num_columns_in);
+
+    EXPECT_EQ(outputs, (std::vector<int16_t>{-32768, -100, -98, 1900, 1900, 9529}));
+}
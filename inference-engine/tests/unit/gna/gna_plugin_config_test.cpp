@@ -22,6 +22,7 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PRECISION), Precision(Precision::I16).name()},
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "1.000000"},
+    {GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR), ""},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
     {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
@@ -131,6 +132,14 @@ TEST_F(GNAPluginConfigTest, GnaConfigDeviceModeTest) {
     ExpectThrow(GNA_CONFIG_KEY(DEVICE_MODE), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigDeviceModeSwExactRefTest) {
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_EXACT_REF);
+    EXPECT_TRUE(config.gnaFlags.sw_exact_ref);
+    ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "2");
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_EXACT);
+    EXPECT_FALSE(config.gnaFlags.sw_exact_ref);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigCompactMode) {
     SetAndCheckFlag(GNA_CONFIG_KEY(COMPACT_MODE),
                     config.gnaFlags.compact_mode);
@@ -166,6 +175,13 @@ TEST_F(GNAPluginConfigTest, GnaConfigPwlMaxErrorPercentTest) {
     ExpectThrow(GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "100.1");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigPwlDesignCacheDirTest) {
+    SetAndCompare(GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR), "cache");
+    EXPECT_EQ(config.pwlDesignCacheDir, "cache");
+    SetAndCompare(GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR), "");
+    EXPECT_TRUE(config.pwlDesignCacheDir.empty());
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigPerfCountTest) {
     SetAndCheckFlag(CONFIG_KEY(PERF_COUNT),
                     config.gnaFlags.performance_counting);
@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "runtime/pwl.h"
+#include "runtime/pwl_design_cache.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+DnnActivation activation(DnnActivationType type) {
+    auto activation_type = DnnActivation::fromType(type);
+    activation_type.fqParams.set = false;
+    activation_type.srcFQParams.set = false;
+    return activation_type;
+}
+
+bool equal(const std::vector<gna_pwl_segment_t>& lhs, const std::vector<gna_pwl_segment_t>& rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i].xBase != rhs[i].xBase || lhs[i].yBase != rhs[i].yBase || lhs[i].slope != rhs[i].slope) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(GNAPwlDesignCacheTest, keyDependsOnDesignParameters) {
+    auto sigmoid = activation(kActSigmoid);
+    auto tanh = activation(kActTanh);
+    const auto key = PwlDesignCache::key(sigmoid, 2048.f, 1024.f, 1.f, false);
+
+    EXPECT_EQ(key, PwlDesignCache::key(sigmoid, 2048.f, 1024.f, 1.f, false));
+    EXPECT_NE(key, PwlDesignCache::key(tanh, 2048.f, 1024.f, 1.f, false));
+    EXPECT_NE(key, PwlDesignCache::key(sigmoid, 4096.f, 1024.f, 1.f, false));
+    EXPECT_NE(key, PwlDesignCache::key(sigmoid, 2048.f, 2048.f, 1.f, false));
+    EXPECT_NE(key, PwlDesignCache::key(sigmoid, 2048.f, 1024.f, 0.5f, false));
+    EXPECT_NE(key, PwlDesignCache::key(sigmoid, 2048.f, 1024.f, 1.f, true));
+}
+
+TEST(GNAPwlDesignCacheTest, keyDependsOnlyOnUsedArguments) {
+    DnnActivation relu, reluWithGarbage;
+    std::memset(&relu, 0, sizeof(relu));
+    std::memset(&reluWithGarbage, 0xA5, sizeof(reluWithGarbage));
+    for (auto activation_type : {&relu, &reluWithGarbage}) {
+        activation_type->type = kActRelu;
+        activation_type->fqParams.set = false;
+        activation_type->srcFQParams.set = false;
+        activation_type->args.lrelu.negative_slope = 0.1f;
+    }
+    EXPECT_EQ(PwlDesignCache::key(relu, 2048.f, 1024.f, 1.f, false),
+              PwlDesignCache::key(reluWithGarbage, 2048.f, 1024.f, 1.f, false));
+
+    reluWithGarbage.args.lrelu.negative_slope = 0.2f;
+    EXPECT_NE(PwlDesignCache::key(relu, 2048.f, 1024.f, 1.f, false),
+              PwlDesignCache::key(reluWithGarbage, 2048.f, 1024.f, 1.f, false));
+}
+
+TEST(GNAPwlDesignCacheTest, optimizedDesignIsReused) {
+    auto sigmoid = activation(kActSigmoid);
+    std::vector<gna_pwl_segment_t> designed, reused;
+    PwlDesignOpt(sigmoid, designed, 2048.f, 8192.f, 1.f, false);
+    ASSERT_FALSE(designed.empty());
+
+    std::vector<gna_pwl_segment_t> cached;
+    ASSERT_TRUE(PwlDesignCache::instance().get(PwlDesignCache::key(sigmoid, 2048.f, 8192.f, 1.f, false), cached));
+    EXPECT_TRUE(equal(designed, cached));
+
+    PwlDesignOpt(sigmoid, reused, 2048.f, 8192.f, 1.f, false);
+    EXPECT_TRUE(equal(designed, reused));
+}
+
+TEST(GNAPwlDesignCacheTest, designsArePersisted) {
+    const std::string path = "gna_pwl_design_cache_test.bin";
+    const std::string key = "persisted design";
+    const std::vector<gna_pwl_segment_t> segments = {{-100, -10, 5}, {0, 0, 100}, {100, 10, 5}};
+
+    PwlDesignCache saved;
+    saved.put(key, segments);
+    saved.save(path);
+
+    PwlDesignCache restored;
+    std::vector<gna_pwl_segment_t> loaded;
+    EXPECT_FALSE(restored.get(key, loaded));
+    restored.load(path);
+    ASSERT_TRUE(restored.get(key, loaded));
+    EXPECT_TRUE(equal(segments, loaded));
+
+    std::remove(path.c_str());
+}
+
+TEST(GNAPwlDesignCacheTest, unknownFileIsIgnored) {
+    const std::string path = "gna_pwl_design_cache_test_unknown.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a cache";
+    }
+    PwlDesignCache cache;
+    EXPECT_NO_THROW(cache.load(path));
+    EXPECT_NO_THROW(cache.load(path + ".missing"));
+
+    std::remove(path.c_str());
+}
+
+TEST(GNAPwlDesignCacheTest, fileOfOtherVersionIsIgnored) {
+    const std::string path = "gna_pwl_design_cache_test_version.bin";
+    const std::string key = "persisted design";
+    PwlDesignCache saved;
+    saved.put(key, {{0, 0, 100}});
+    saved.save(path);
+    {
+        // the version follows the magic
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8);
+        const uint32_t version = 0xFFFFFFFF;
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+
+    PwlDesignCache restored;
+    std::vector<gna_pwl_segment_t> loaded;
+    restored.load(path);
+    EXPECT_FALSE(restored.get(key, loaded));
+
+    std::remove(path.c_str());
+}
@@ -276,6 +276,18 @@ TEST_F(NV12BlobTests, cannotCreateNV12BlobFromPlanesWithNonU8Precision) {
         InferenceEngine::Exception);
 }
 
+TEST_F(NV12BlobTests, canCreateP010BlobFromU16Planes) {
+    Blob::Ptr y = make_shared_blob<uint16_t>(TensorDesc(Precision::U16, {1, 1, 4, 4}, NHWC));
+    Blob::Ptr uv = make_shared_blob<uint16_t>(TensorDesc(Precision::U16, {1, 2, 2, 2}, NHWC));
+    EXPECT_NO_THROW(make_shared_blob<NV12Blob>(y, uv));
+}
+
+TEST_F(NV12BlobTests, cannotCreateNV12BlobFromPlanesWithDifferentPrecision) {
+    Blob::Ptr y = make_shared_blob<uint16_t>(TensorDesc(Precision::U16, {1, 1, 4, 4}, NHWC));
+    Blob::Ptr uv = make_shared_blob<int16_t>(TensorDesc(Precision::I16, {1, 2, 2, 2}, NHWC));
+    EXPECT_THROW(make_shared_blob<NV12Blob>(y, uv), InferenceEngine::Exception);
+}
+
 TEST_F(NV12BlobTests, cannotCreateNV12BlobFromPlanesWithInconsistentBatchSize) {
     Blob::Ptr y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NHWC));
     Blob::Ptr uv = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 2, 2, 2}, NHWC));
@@ -0,0 +1,153 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/allocator/allocator.hpp>
+#include <vpu/middleend/allocator/cmx_packing.hpp>
+
+namespace vpu {
+
+class VPU_CMXPackingTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        config.enableOfflineCmxPacking = true;
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _testModel = CreateTestModel();
+    }
+
+    // input -> stage 0 -> CMX data 0 -> stage 1 -> ... -> CMX data N - 1 -> stage N -> output
+    DataVector CreateChain(int numCmxDatas) {
+        const DataDesc desc{1024};
+
+        _testModel.createInputs({desc});
+        _testModel.createOutputs({desc});
+
+        DataVector cmxDatas;
+        for (int stageInd = 0; stageInd < numCmxDatas; ++stageInd) {
+            const auto input = stageInd == 0 ? InputInfo::fromNetwork() : InputInfo::fromPrevStage(stageInd - 1);
+            const auto stage = _testModel.addStage({input}, {OutputInfo::intermediate(desc)});
+
+            stage->output(0)->setMemReqs(MemoryType::CMX);
+            cmxDatas.push_back(stage->output(0));
+        }
+        _testModel.addStage({InputInfo::fromPrevStage(numCmxDatas - 1)}, {OutputInfo::fromNetwork()});
+
+        return cmxDatas;
+    }
+
+    TestModel _testModel;
+};
+
+TEST_F(VPU_CMXPackingTest, DatasWithDisjointLifetimesShareRegion) {
+    const auto cmxDatas = CreateChain(3);
+    const auto& model = _testModel.getBaseModel();
+
+    const auto lifetimes = calcDataLifetimes(model);
+    ASSERT_TRUE(lifetimes.at(cmxDatas[0]).intersects(lifetimes.at(cmxDatas[1])));
+    ASSERT_FALSE(lifetimes.at(cmxDatas[0]).intersects(lifetimes.at(cmxDatas[2])));
+
+    const auto plan = planCMXPacking(model);
+    const auto size = calcAllocationSize(cmxDatas[0]);
+
+    ASSERT_EQ(plan.offsets.size(), cmxDatas.size());
+    ASSERT_EQ(plan.offsets.at(cmxDatas[0]), plan.offsets.at(cmxDatas[2]));
+    ASSERT_NE(plan.offsets.at(cmxDatas[0]), plan.offsets.at(cmxDatas[1]));
+    ASSERT_EQ(plan.peakSize, 2 * size);
+}
+
+TEST_F(VPU_CMXPackingTest, LookaheadLowersPeakOfBestFit) {
+    //
+    // Lifetimes (in size units) : data 0 [0, 1] x 4, data 1 [0, 3] x 3, data 2 [2, 3] x 3, data 3 and data 4 [2, 3] x 2.
+    // Best fit puts data 2 to the gap left by data 0, so data 3 and data 4 don't fit there and the peak is 11 units.
+    // Lookahead puts data 2 above data 1 and the gap is taken by data 3 and data 4 : the peak is 10 units.
+    //
+
+    const auto unit = 1024;
+    const DataDesc chainDesc{unit};
+
+    _testModel.createInputs({chainDesc});
+    _testModel.createOutputs({chainDesc});
+
+    const auto cmxOutput = [](int numUnits) {
+        return OutputInfo::intermediate(DataDesc{unit * numUnits});
+    };
+
+    const auto stage0 = _testModel.addStage({InputInfo::fromNetwork()},
+                                            {OutputInfo::intermediate(chainDesc), cmxOutput(4), cmxOutput(3)});
+    _testModel.addStage({InputInfo::fromPrevStage(0), InputInfo::fromPrevStage(0, 1)}, {OutputInfo::intermediate(chainDesc)});
+    const auto stage2 = _testModel.addStage({InputInfo::fromPrevStage(1)},
+                                            {OutputInfo::intermediate(chainDesc), cmxOutput(3), cmxOutput(2), cmxOutput(2)});
+    _testModel.addStage({InputInfo::fromPrevStage(2), InputInfo::fromPrevStage(0, 2),
+                         InputInfo::fromPrevStage(2, 1), InputInfo::fromPrevStage(2, 2), InputInfo::fromPrevStage(2, 3)},
+                        {OutputInfo::intermediate(chainDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(3)}, {OutputInfo::fromNetwork()});
+
+    const DataVector cmxDatas{stage0->output(1), stage0->output(2), stage2->output(1), stage2->output(2), stage2->output(3)};
+    for (const auto& data : cmxDatas) {
+        data->setMemReqs(MemoryType::CMX);
+    }
+
+    const auto& model = _testModel.getBaseModel();
+    const auto lifetimes = calcDataLifetimes(model);
+    const auto plan = planCMXPacking(model);
+
+    ASSERT_EQ(plan.offsets.size(), cmxDatas.size());
+    for (const auto& data : cmxDatas) {
+        for (const auto& other : cmxDatas) {
+            if (data == other || !lifetimes.at(data).intersects(lifetimes.at(other))) {
+                continue;
+            }
+            const auto offset = plan.offsets.at(data);
+            const auto otherOffset = plan.offsets.at(other);
+            ASSERT_TRUE(offset + calcAllocationSize(data) <= otherOffset || otherOffset + calcAllocationSize(other) <= offset)
+                << data->name() << " overlaps " << other->name();
+        }
+    }
+
+    ASSERT_EQ(plan.peakSize, calcAllocationSize(cmxDatas[0]) + calcAllocationSize(cmxDatas[1]) + calcAllocationSize(cmxDatas[2]));
+}
+
+TEST_F(VPU_CMXPackingTest, PackerAddsDataWithoutMovingPlanned) {
+    const auto cmxDatas = CreateChain(4);
+    const auto& model = _testModel.getBaseModel();
+
+    cmxDatas[1]->setMemReqs(MemoryType::DDR);
+    CMXPacker packer(model);
+    const auto plan = packer.plan();
+    ASSERT_EQ(plan.offsets.size(), cmxDatas.size() - 1);
+    ASSERT_EQ(plan.offsets.count(cmxDatas[1]), 0u);
+
+    cmxDatas[1]->setMemReqs(MemoryType::CMX);
+    packer.add(cmxDatas[1]);
+    ASSERT_EQ(packer.plan().offsets.size(), cmxDatas.size());
+    for (const auto& p : plan.offsets) {
+        ASSERT_EQ(packer.plan().offsets.at(p.first), p.second);
+    }
+    ASSERT_EQ(packer.plan().peakSize, 2 * calcAllocationSize(cmxDatas[0]));
+    ASSERT_EQ(runAllocator(model, packer.plan(), EnableShapeAllocation::NO, CheckOnlyCMX::NO).status, AllocationStatus::OK);
+    ASSERT_EQ(model->getAllocator().statistics().plannedDatas, static_cast<int>(cmxDatas.size()));
+
+    packer.remove(cmxDatas[1]);
+    ASSERT_EQ(packer.plan().offsets, plan.offsets);
+    ASSERT_EQ(packer.plan().peakSize, plan.peakSize);
+}
+
+TEST_F(VPU_CMXPackingTest, AllocatorFollowsPlanAndReportsStatistics) {
+    const auto cmxDatas = CreateChain(4);
+    const auto& model = _testModel.getBaseModel();
+
+    ASSERT_EQ(runAllocator(model).status, AllocationStatus::OK);
+
+    const auto statistics = model->getAllocator().statistics();
+    ASSERT_EQ(statistics.plannedDatas, static_cast<int>(cmxDatas.size()));
+    ASSERT_EQ(statistics.unplannedDatas, 0);
+    ASSERT_EQ(statistics.spilledDatas, 0);
+    ASSERT_EQ(statistics.peakCMX, 2 * calcAllocationSize(cmxDatas[0]));
+    ASSERT_EQ(statistics.peakCMX, statistics.peakLiveCMX);
+}
+
+}  // namespace vpu
@@ -0,0 +1,241 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <common_test_utils/common_utils.hpp>
+#include <common_test_utils/file_utils.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
+
+using namespace vpu;
+
+class VPU_HWTilingCacheTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+        HWTilingNS::clearTilingCache();
+    }
+
+    void TearDown() override {
+        HWTilingNS::clearTilingCache();
+        GraphTransformerTest::TearDown();
+    }
+
+    static HWTilingNS::ConvolutionOptions convOptions(const std::string& name, int size, int channels, bool withPool = false) {
+        DimValues inputDims;
+        inputDims.set(Dim::W, size);
+        inputDims.set(Dim::H, size);
+        inputDims.set(Dim::C, channels);
+        inputDims.set(Dim::N, 1);
+
+        auto outputDims = inputDims;
+        if (withPool) {
+            outputDims.set(Dim::W, size / 2);
+            outputDims.set(Dim::H, size / 2);
+        }
+
+        return HWTilingNS::ConvolutionOptions{name, inputDims, outputDims, inputDims, 3, 3, 1, 1, 1, 1, 1, withPool};
+    }
+
+    static void compareDecisions(const HWTilingNS::ConvTilingDecision& expected, const HWTilingNS::ConvTilingDecision& actual) {
+        ASSERT_EQ(expected.tilingPossible, actual.tilingPossible);
+        ASSERT_EQ(expected.withPool, actual.withPool);
+        ASSERT_EQ(expected.hwTilings.size(), actual.hwTilings.size());
+        for (size_t tilingInd = 0; tilingInd < expected.hwTilings.size(); ++tilingInd) {
+            const auto& e = expected.hwTilings[tilingInd];
+            const auto& a = actual.hwTilings[tilingInd];
+            ASSERT_EQ(e->sohTiles, a->sohTiles);
+            ASSERT_EQ(e->sowTiles, a->sowTiles);
+            ASSERT_EQ(e->socTiles, a->socTiles);
+            ASSERT_EQ(e->planeTiles.size(), a->planeTiles.size());
+            for (size_t tileInd = 0; tileInd < e->planeTiles.size(); ++tileInd) {
+                ASSERT_EQ(e->planeTiles[tileInd]->channelTiles.size(), a->planeTiles[tileInd]->channelTiles.size());
+                ASSERT_EQ(e->planeTiles[tileInd]->heightInfo.inputWithJunk, a->planeTiles[tileInd]->heightInfo.inputWithJunk);
+                ASSERT_EQ(e->planeTiles[tileInd]->heightInfo.outputWithJunk, a->planeTiles[tileInd]->heightInfo.outputWithJunk);
+                ASSERT_EQ(e->planeTiles[tileInd]->widthInfo.inputWithJunk, a->planeTiles[tileInd]->widthInfo.inputWithJunk);
+                ASSERT_EQ(e->planeTiles[tileInd]->widthInfo.outputWithJunk, a->planeTiles[tileInd]->widthInfo.outputWithJunk);
+            }
+        }
+    }
+
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+};
+
+class VPU_HWTilingCacheDirTest : public VPU_HWTilingCacheTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(VPU_HWTilingCacheTest::SetUp());
+        CommonTestUtils::removeFilesWithExt(cacheDir, "txt");
+        CommonTestUtils::createDirectory(cacheDir);
+        ASSERT_TRUE(CommonTestUtils::directoryExists(cacheDir));
+
+        config.tilingCacheDir = cacheDir;
+        CompileEnv::updateConfig(config);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "txt");
+        CommonTestUtils::removeDir(cacheDir);
+        VPU_HWTilingCacheTest::TearDown();
+    }
+
+    std::vector<std::string> cacheFiles() const {
+        return CommonTestUtils::listFilesWithExt(cacheDir, "txt");
+    }
+
+    // unique per run, so concurrent runs of the tests don't share stored results
+    const std::string cacheDir = std::string("VPU_HWTilingCacheDirTest_") +
+        ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + CommonTestUtils::GetTimestamp();
+};
+
+TEST_F(VPU_HWTilingCacheTest, StagesWithSameParametersShareDecision) {
+    const auto first = HWTilingNS::tileConvolution(convOptions("conv1", 224, 64), direction, 1);
+    const auto second = HWTilingNS::tileConvolution(convOptions("conv2", 224, 64), direction, 1);
+    const auto other = HWTilingNS::tileConvolution(convOptions("conv3", 112, 64), direction, 1);
+
+    ASSERT_TRUE(first->tilingPossible);
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+}
+
+TEST_F(VPU_HWTilingCacheTest, ParallelSearchGivesSameTilingsAsSequentialOne) {
+    std::vector<HWTilingNS::ConvolutionOptions> stagesOptions;
+    for (int size : {28, 56, 112, 224}) {
+        for (int channels : {16, 64, 256}) {
+            for (bool withPool : {false, true}) {
+                stagesOptions.push_back(convOptions("conv", size, channels, withPool));
+            }
+        }
+    }
+
+    const auto decisions = HWTilingNS::findTilings<HWTilingNS::ConvTilingDecision>(
+        stagesOptions,
+        [&](const HWTilingNS::ConvolutionOptions& options) {
+            return HWTilingNS::tileConvolution(options, direction, 1);
+        });
+    ASSERT_EQ(decisions.size(), stagesOptions.size());
+
+    for (size_t stageInd = 0; stageInd < stagesOptions.size(); ++stageInd) {
+        const HWTilingNS::HWConvolutionTiler tiler(stagesOptions[stageInd], direction, 1);
+        const auto& decision = *decisions[stageInd];
+        if (!tiler.isTilingPossible() && tiler.withPool()) {
+            // decision falls back to convolution without merged pooling
+            ASSERT_FALSE(decision.withPool);
+            continue;
+        }
+
+        ASSERT_EQ(decision.tilingPossible, tiler.isTilingPossible());
+        ASSERT_EQ(decision.withPool, tiler.withPool());
+        ASSERT_EQ(decision.hwTilings.size(), tiler.getHwTilings().size());
+        for (size_t tilingInd = 0; tilingInd < decision.hwTilings.size(); ++tilingInd) {
+            const auto& cached = decision.hwTilings[tilingInd];
+            const auto& expected = tiler.getHwTilings()[tilingInd];
+            ASSERT_EQ(cached->sohTiles, expected->sohTiles);
+            ASSERT_EQ(cached->sowTiles, expected->sowTiles);
+            ASSERT_EQ(cached->socTiles, expected->socTiles);
+        }
+    }
+}
+
+TEST_F(VPU_HWTilingCacheDirTest, SearchResultIsStoredPerShapeAndResources) {
+    HWTilingNS::tileConvolution(convOptions("conv1", 224, 64), direction, 1);
+    ASSERT_EQ(cacheFiles().size(), 1u);
+
+    // stage name is not a part of the key
+    HWTilingNS::clearTilingCache();
+    HWTilingNS::tileConvolution(convOptions("conv2", 224, 64), direction, 1);
+    ASSERT_EQ(cacheFiles().size(), 1u);
+
+    HWTilingNS::tileConvolution(convOptions("conv3", 112, 64), direction, 1);
+    ASSERT_EQ(cacheFiles().size(), 2u);
+
+    CompileEnv::free();
+    config.tilingCMXLimitKB = 64;
+    ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    HWTilingNS::clearTilingCache();
+    HWTilingNS::tileConvolution(convOptions("conv1", 224, 64), direction, 1);
+    ASSERT_EQ(cacheFiles().size(), 3u);
+}
+
+TEST_F(VPU_HWTilingCacheDirTest, DecisionFoundWithoutCacheDirIsStoredWhenItIsSet) {
+    config.tilingCacheDir.clear();
+    CompileEnv::updateConfig(config);
+    const auto searched = HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1);
+    ASSERT_TRUE(cacheFiles().empty());
+
+    config.tilingCacheDir = cacheDir;
+    CompileEnv::updateConfig(config);
+    const auto stored = HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1);
+    ASSERT_EQ(cacheFiles().size(), 1u);
+    ASSERT_NO_FATAL_FAILURE(compareDecisions(*searched, *stored));
+}
+
+TEST_F(VPU_HWTilingCacheDirTest, StoredSearchResultGivesSameTilingsAsSearch) {
+    std::vector<HWTilingNS::ConvolutionOptions> stagesOptions;
+    for (int size : {28, 56, 112, 224}) {
+        for (int channels : {16, 64, 256}) {
+            for (bool withPool : {false, true}) {
+                stagesOptions.push_back(convOptions("conv", size, channels, withPool));
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<const HWTilingNS::ConvTilingDecision>> searched;
+    for (const auto& options : stagesOptions) {
+        searched.push_back(HWTilingNS::tileConvolution(options, direction, 3));
+    }
+    const auto numFiles = cacheFiles().size();
+    ASSERT_GT(numFiles, 0u);
+
+    // as in a new process, only cache directory is left
+    HWTilingNS::clearTilingCache();
+    for (size_t stageInd = 0; stageInd < stagesOptions.size(); ++stageInd) {
+        const auto loaded = HWTilingNS::tileConvolution(stagesOptions[stageInd], direction, 3);
+        ASSERT_NE(loaded, searched[stageInd]);
+        ASSERT_NO_FATAL_FAILURE(compareDecisions(*searched[stageInd], *loaded));
+    }
+    ASSERT_EQ(cacheFiles().size(), numFiles);
+}
+
+TEST_F(VPU_HWTilingCacheDirTest, StoredSearchResultIsUsedInsteadOfSearch) {
+    ASSERT_TRUE(HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1)->tilingPossible);
+    const auto files = cacheFiles();
+    ASSERT_EQ(files.size(), 1u);
+
+    // search result without tiling options
+    std::ifstream file(files.front());
+    std::string header, key, numOptions, option, inputTileDims, outputTileDims;
+    ASSERT_TRUE(std::getline(file, header) && std::getline(file, key) && std::getline(file, numOptions) &&
+                std::getline(file, option) && std::getline(file, inputTileDims) && std::getline(file, outputTileDims));
+    ASSERT_EQ(numOptions, "1");
+    file.close();
+    CommonTestUtils::createFile(files.front(), header + "\n" + key + "\n0\n" + inputTileDims + "\n" + outputTileDims + "\n");
+
+    HWTilingNS::clearTilingCache();
+    ASSERT_FALSE(HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1)->tilingPossible);
+}
+
+TEST_F(VPU_HWTilingCacheDirTest, CorruptedSearchResultIsReplaced) {
+    const auto searched = HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1);
+    const auto files = cacheFiles();
+    ASSERT_EQ(files.size(), 1u);
+
+    std::ifstream file(files.front());
+    std::string header, key;
+    ASSERT_TRUE(std::getline(file, header) && std::getline(file, key));
+    file.close();
+    CommonTestUtils::createFile(files.front(), header + "\n" + key + "\n1\n2 3");
+
+    HWTilingNS::clearTilingCache();
+    const auto searchedAgain = HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1);
+    ASSERT_NO_FATAL_FAILURE(compareDecisions(*searched, *searchedAgain));
+
+    HWTilingNS::clearTilingCache();
+    const auto loaded = HWTilingNS::tileConvolution(convOptions("conv", 224, 64), direction, 1);
+    ASSERT_NO_FATAL_FAILURE(compareDecisions(*searched, *loaded));
+}
@@ -15,6 +15,7 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/imgproc.hpp>
 
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
 #include <ctime>
@@ -72,6 +73,7 @@ cv::String interpToString(int interp)
     {
     case cv::INTER_AREA   : return "INTER_AREA";
     case cv::INTER_LINEAR : return "INTER_LINEAR";
+    case cv::INTER_CUBIC  : return "INTER_CUBIC";
     case cv::INTER_NEAREST: return "INTER_NEAREST";
     }
     CV_Assert(!"ERROR: unsupported interpolation!");
@@ -117,6 +119,10 @@ cv::String colorFormatToString(InferenceEngine::ColorFormat f) {
         case ColorFormat::RGBX: return "RGBX";
         case ColorFormat::BGRX: return "BGRX";
         case ColorFormat::NV12: return "NV12";
+        case ColorFormat::I420: return "I420";
+        case ColorFormat::YUYV: return "YUYV";
+        case ColorFormat::UYVY: return "UYVY";
+        case ColorFormat::P010: return "P010";
         default: IE_THROW() << "Unrecognized color format";
     }
 }
@@ -161,7 +167,11 @@ cv::ColorConversionCodes toCvtColorCode(InferenceEngine::ColorFormat in,
         {{ColorFormat::BGR, ColorFormat::BGRX}, cv::COLOR_BGR2BGRA},
         {{ColorFormat::BGR, ColorFormat::RGB}, cv::COLOR_BGR2RGB},
         {{ColorFormat::NV12, ColorFormat::BGR}, cv::COLOR_YUV2BGR_NV12},
-        {{ColorFormat::NV12, ColorFormat::RGB}, cv::COLOR_YUV2RGB_NV12}
+        {{ColorFormat::NV12, ColorFormat::RGB}, cv::COLOR_YUV2RGB_NV12},
+        {{ColorFormat::YUYV, ColorFormat::BGR}, cv::COLOR_YUV2BGR_YUYV},
+        {{ColorFormat::YUYV, ColorFormat::RGB}, cv::COLOR_YUV2RGB_YUYV},
+        {{ColorFormat::UYVY, ColorFormat::BGR}, cv::COLOR_YUV2BGR_UYVY},
+        {{ColorFormat::UYVY, ColorFormat::RGB}, cv::COLOR_YUV2RGB_UYVY}
     };
     return types.at(std::make_pair(in, out));
 }
@@ -762,7 +772,7 @@ TEST_P(ResizeTestIE, AccuracyTest)
     int depth = CV_MAT_DEPTH(type);
     CV_Assert(CV_8U == depth || CV_32F == depth);
 
-    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_CUBIC == interp);
 
     ASSERT_TRUE(in_mat1.isContinuous() && out_mat.isContinuous());
 
@@ -785,7 +795,8 @@ TEST_P(ResizeTestIE, AccuracyTest)
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
     preprocess->setRoiBlob(in_blob);
 
-    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
+    ResizeAlgorithm algorithm = cv::INTER_AREA  == interp ? RESIZE_AREA :
+                                cv::INTER_CUBIC == interp ? RESIZE_BICUBIC : RESIZE_BILINEAR;
     PreProcessInfo info;
     info.setResizeAlgorithm(algorithm);
 
@@ -810,6 +821,251 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(BatchedResizeTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    int batch = 0;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, interp, sizes, batch, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    std::vector<cv::Mat> in_mats(batch);
+    for (auto &in_mat : in_mats) {
+        in_mat.create(sz_in, type);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+    }
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = CV_MAT_CN(type);
+    int depth = CV_MAT_DEPTH(type);
+
+    using namespace InferenceEngine;
+
+    InferenceEngine::SizeVector  in_sv = { 1, channels, static_cast<size_t>(sz_in.height),  static_cast<size_t>(sz_in.width) };
+    InferenceEngine::SizeVector out_sv = { static_cast<size_t>(batch), channels,
+                                           static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+
+    // HWC blobs: channels are interleaved, every image of the batch is a separate blob
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    TensorDesc  in_desc(precision,  in_sv, Layout::NHWC);
+    TensorDesc out_desc(precision, out_sv, Layout::NHWC);
+
+    std::vector<Blob::Ptr> in_blobs;
+    for (auto &in_mat : in_mats) {
+        in_blobs.push_back(make_blob_with_precision(in_desc, in_mat.data));
+    }
+    Blob::Ptr in_blob = make_shared_blob<BatchedBlob>(in_blobs);
+
+    // output images of the batch are stored one after another
+    cv::Mat out_mat(sz_out.height * batch, sz_out.width, type);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+
+    preprocess->execute(out_blob, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Batched resize IE %s %s %dx%d -> %dx%d, batch %d",
+            interpToString(interp).c_str(), typeToString(type).c_str(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height, batch);
+#endif
+
+    // OpenCV code and comparison //////////////////////////////////////////////
+    for (int i = 0; i < batch; i++) {
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mats[i], out_mat_ocv, sz_out, 0, 0, interp);
+        cv::Mat out_mat_ie = out_mat(cv::Rect(0, i * sz_out.height, sz_out.width, sz_out.height));
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_ie, cv::NORM_INF), tolerance) << "batch item " << i;
+    }
+}
+
+TEST(BatchedBlobTestIE, ThrowsForItemsOfDifferentKinds)
+{
+    using namespace InferenceEngine;
+
+    // BatchedBlob compares only Y planes of its items, so NV12 and I420 items of the same size
+    // are accepted by it, while the graph compiled for the first item can't process the second one
+    const cv::Size sz_in(96, 64), sz_out(224, 224);
+    cv::Mat in_mat_y(sz_in, CV_8UC1, cv::Scalar::all(0));
+    cv::Mat in_mat_uv(cv::Size(48, 32), CV_8UC2, cv::Scalar::all(0));
+    cv::Mat in_mat_u(cv::Size(48, 32), CV_8UC1, cv::Scalar::all(0));
+    cv::Mat in_mat_v(cv::Size(48, 32), CV_8UC1, cv::Scalar::all(0));
+
+    std::vector<Blob::Ptr> in_blobs{
+        make_shared_blob<NV12Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                   img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC)),
+        make_shared_blob<I420Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                   img2Blob<Precision::U8>(in_mat_u, Layout::NHWC),
+                                   img2Blob<Precision::U8>(in_mat_v, Layout::NHWC))};
+    Blob::Ptr in_blob = make_shared_blob<BatchedBlob>(in_blobs);
+
+    const size_t batch = in_blobs.size();
+    cv::Mat out_mat(sz_out.height * static_cast<int>(batch), sz_out.width, CV_8UC3);
+    TensorDesc out_desc(Precision::U8, { batch, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) },
+                        Layout::NHWC);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    EXPECT_THROW(preprocess->isApplicable(in_blob, out_blob), Exception);
+    for (auto in_fmt : {ColorFormat::NV12, ColorFormat::I420}) {
+        info.setColorFormat(in_fmt);
+        EXPECT_THROW(preprocess->execute(out_blob, info, false), Exception) << in_fmt;
+    }
+}
+
+TEST_P(NormalizeTestIE, AccuracyTest)
+{
+    int type = 0;
+    InferenceEngine::Layout out_layout = InferenceEngine::ANY;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, out_layout, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat1(sz_in, type);
+    cv::randn(in_mat1, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    const int channels = CV_MAT_CN(type);
+    const std::vector<float> mean  = {123.675f, 116.28f, 103.53f};
+    const std::vector<float> scale = {1.f / 58.395f, 1.f / 57.12f, 1.f / 57.375f};
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    using namespace InferenceEngine;
+
+    SizeVector  in_sv = { 1, static_cast<size_t>(channels), static_cast<size_t>(sz_in.height),  static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { 1, static_cast<size_t>(channels), static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+
+    Precision precision = CV_MAT_DEPTH(type) == CV_8U ? Precision::U8 : Precision::FP32;
+    TensorDesc  in_desc(precision,       in_sv, Layout::NHWC);
+    TensorDesc out_desc(Precision::FP32, out_sv, out_layout);
+
+    Blob::Ptr in_blob = make_blob_with_precision(in_desc, in_mat1.data);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc);
+    out_blob->allocate();
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.init(channels);
+    for (int c = 0; c < channels; c++) {
+        info[c]->meanValue = mean[c];
+        info[c]->stdScale = scale[c];
+    }
+    info.setVariant(MEAN_VALUE);
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    preprocess->execute(out_blob, info, false, -1, true);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false, -1, true); },
+            100, "Normalize IE %s %dx%d -> %dx%d",
+            typeToString(type).c_str(), sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    std::vector<cv::Mat> out_planes_ocv;
+    {
+        cv::Mat resized;
+        cv::resize(in_mat1, resized, sz_out, 0, 0, cv::INTER_LINEAR);
+        cv::split(resized, out_planes_ocv);
+        for (int c = 0; c < channels; c++) {
+            out_planes_ocv[c].convertTo(out_planes_ocv[c], CV_32F, scale[c], -mean[c] * scale[c]);
+        }
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        auto out_ptr = out_blob->buffer().as<float*>();
+        for (int c = 0; c < channels; c++) {
+            cv::Mat out_plane_ie = out_layout == Layout::NCHW ?
+                cv::Mat(sz_out, CV_32FC1, out_ptr + c * sz_out.area()) :
+                cv::Mat(sz_out, CV_32FC1, out_ptr + c, channels * sizeof(float));
+            EXPECT_LE(cv::norm(out_planes_ocv[c], out_plane_ie, cv::NORM_INF), tolerance) << "channel " << c;
+        }
+    }
+}
+
+TEST_P(LetterboxTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    double pad = 0.0;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, interp, sizes, pad, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat1(sz_in, type );
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat1, mean, stddev);
+
+    cv::Mat out_mat(sz_out, type);
+    cv::Mat out_mat_ocv(sz_out, type, cv::Scalar::all(pad));
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = out_mat.channels();
+    int depth = CV_MAT_DEPTH(type);
+
+    using namespace InferenceEngine;
+
+    InferenceEngine::SizeVector  in_sv = { 1, channels, static_cast<size_t>(sz_in.height),  static_cast<size_t>(sz_in.width) };
+    InferenceEngine::SizeVector out_sv = { 1, channels, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+
+    // HWC blob: channels are interleaved
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    TensorDesc  in_desc(precision,  in_sv, Layout::NHWC);
+    TensorDesc out_desc(precision, out_sv, Layout::NHWC);
+
+    Blob::Ptr in_blob, out_blob;
+    in_blob  = make_blob_with_precision(in_desc , in_mat1.data);
+    out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_CUBIC == interp ? RESIZE_BICUBIC : RESIZE_BILINEAR);
+    info.setResizeMode(ResizeMode::LETTERBOX, static_cast<float>(pad));
+
+    preprocess->execute(out_blob, info, false);
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        double scale = std::min(static_cast<double>(sz_out.width) / sz_in.width,
+                                static_cast<double>(sz_out.height) / sz_in.height);
+        cv::Size sz_fit(std::max(1, std::min(sz_out.width,  static_cast<int>(std::round(sz_in.width  * scale)))),
+                        std::max(1, std::min(sz_out.height, static_cast<int>(std::round(sz_in.height * scale)))));
+        cv::Rect roi((sz_out.width - sz_fit.width) / 2, (sz_out.height - sz_fit.height) / 2,
+                     sz_fit.width, sz_fit.height);
+        cv::Mat fit = out_mat_ocv(roi);
+        cv::resize(in_mat1, fit, sz_fit, 0, 0, interp);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -996,8 +1252,20 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
         auto v_blob = img2Blob<Precision::U8>(in_mat_v, Layout::NHWC);
         return make_shared_blob<I420Blob>(y_blob, u_blob, v_blob);
     };
+    auto make_p010_blob = [&](){
+        // 10-bit samples are kept in the high bits. two low bits of samples are zero, so the result
+        // matches the 8-bit NV12 one exactly
+        cv::Mat in_mat_y16, in_mat_uv16;
+        in_mat_y.convertTo(in_mat_y16, CV_16U, 256);
+        in_mat_uv.convertTo(in_mat_uv16, CV_16U, 256);
+
+        auto y_blob = img2Blob<Precision::U16>(in_mat_y16, Layout::NHWC);
+        auto uv_blob = img2Blob<Precision::U16>(in_mat_uv16, Layout::NHWC);
+        return make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    };
 
-    Blob::Ptr in_blob = (in_fmt == ColorFormat::NV12) ?  Blob::Ptr{make_nv12_blob()} :  Blob::Ptr {make_I420_blob()};
+    Blob::Ptr in_blob = (in_fmt == ColorFormat::NV12) ? Blob::Ptr{make_nv12_blob()} :
+                        (in_fmt == ColorFormat::P010) ? Blob::Ptr{make_p010_blob()} : Blob::Ptr{make_I420_blob()};
     auto out_blob = img2Blob<Precision::U8>(out_mat, out_layout);
 
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
@@ -1023,7 +1291,7 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
 
     // OpenCV code /////////////////////////////////////////////////////////////
     {
-        //for both I420 and NV12 use NV12 as I420 is not supported by OCV
+        //for I420, NV12 and P010 use NV12 as I420 and P010 are not supported by OCV
         cv::cvtColorTwoPlane(in_mat_y, in_mat_uv, out_mat_ocv, toCvtColorCode(ColorFormat::NV12, out_fmt));
     }
 
@@ -1033,6 +1301,96 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST(ColorConvertYUV420PrecisionTestIE, ThrowsForPlanesOfOtherColorFormat)
+{
+    using namespace InferenceEngine;
+
+    // NV12 planes are U8, P010 ones are U16, NV12Blob accepts both of them
+    const cv::Size size(64, 32);
+    for (auto in_fmt : {ColorFormat::NV12, ColorFormat::P010}) {
+        const int depth = (in_fmt == ColorFormat::NV12) ? CV_16U : CV_8U;
+        cv::Mat in_mat_y(size, CV_MAKE_TYPE(depth, 1), cv::Scalar::all(0));
+        cv::Mat in_mat_uv(cv::Size(size.width / 2, size.height / 2), CV_MAKE_TYPE(depth, 2), cv::Scalar::all(0));
+        cv::Mat out_mat(size, CV_8UC3);
+
+        Blob::Ptr in_blob = (depth == CV_8U)
+            ? make_shared_blob<NV12Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                         img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC))
+            : make_shared_blob<NV12Blob>(img2Blob<Precision::U16>(in_mat_y, Layout::NHWC),
+                                         img2Blob<Precision::U16>(in_mat_uv, Layout::NHWC));
+        auto out_blob = img2Blob<Precision::U8>(out_mat, Layout::NHWC);
+
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+
+        PreProcessInfo info;
+        info.setColorFormat(in_fmt);
+
+        EXPECT_THROW(preprocess->execute(out_blob, info, false), Exception) << in_fmt;
+    }
+}
+
+TEST_P(ColorConvertYUV422TestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    const int depth = CV_8U;
+    auto in_fmt = ColorFormat::YUYV;
+    const auto out_fmt = ColorFormat::BGR;  // for now, always BGR
+    const auto in_layout = Layout::NHWC;
+    auto out_layout = Layout::ANY;
+    cv::Size size;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, size, tolerance) = GetParam();
+
+    cv::Mat in_mat(size, CV_MAKE_TYPE(depth, 2));
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat, mean, stddev);
+
+    int out_type = CV_MAKE_TYPE(depth, numChannels(out_fmt));
+    cv::Mat out_mat(size, out_type);
+    cv::Mat out_mat_ocv(size, out_type);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    ASSERT_TRUE(in_mat.isContinuous() && out_mat.isContinuous());
+
+    auto in_blob = img2Blob<Precision::U8>(in_mat, in_layout);
+    auto out_blob = img2Blob<Precision::U8>(out_mat, out_layout);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+
+    // test once to warm-up cache
+    preprocess->execute(out_blob, info, false);
+
+    Blob2Img<Precision::U8>(out_blob, out_mat, out_layout);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Color Convert IE %s %s %s %dx%d %s->%s",
+            depthToString(depth).c_str(),
+            layoutToString(in_layout).c_str(), layoutToString(out_layout).c_str(),
+            size.width, size.height,
+            colorFormatToString(in_fmt).c_str(), colorFormatToString(out_fmt).c_str());
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        cv::cvtColor(in_mat, out_mat_ocv, toCvtColorCode(in_fmt, out_fmt));
+    }
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
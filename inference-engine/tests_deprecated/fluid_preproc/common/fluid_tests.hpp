@@ -41,6 +41,26 @@ struct MeanValueGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 
+struct BatchedResizeTestIE: public testing::TestWithParam<std::tuple<int,  // matrix type
+                                                                     int,  // interpolation
+                                                                     std::pair<cv::Size, cv::Size>,
+                                                                     int,  // batch size
+                                                                     double>>  // tolerance
+{};
+
+struct NormalizeTestIE: public testing::TestWithParam<std::tuple<int,  // input matrix type
+                                                                 InferenceEngine::Layout,  // output layout
+                                                                 std::pair<cv::Size, cv::Size>,
+                                                                 double>>  // tolerance
+{};
+
+struct LetterboxTestIE: public testing::TestWithParam<std::tuple<int,  // matrix type
+                                                                 int,  // interpolation
+                                                                 std::pair<cv::Size, cv::Size>,
+                                                                 double,  // pad value
+                                                                 double>>  // tolerance
+{};
+
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 
@@ -54,7 +74,14 @@ struct ColorConvertTestIE:
 {};
 
 struct ColorConvertYUV420TestIE:
-    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format NV12 or I420
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format NV12, I420 or P010
+                                             InferenceEngine::Layout,       // output layout
+                                             cv::Size,                      // matrix size (input and output)
+                                             double>>                       // tolerance
+{};
+
+struct ColorConvertYUV422TestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format YUYV or UYVY
                                              InferenceEngine::Layout,       // output layout
                                              cv::Size,                      // matrix size (input and output)
                                              double>>                       // tolerance
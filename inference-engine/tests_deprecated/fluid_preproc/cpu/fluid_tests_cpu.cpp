@@ -235,10 +235,46 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_U8, ResizeTestIE,
 
 INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                         Combine(Values(CV_32FC1, CV_32FC3),
-                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_CUBIC),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+// OpenCV computes 8U bi-cubic resize in fixed point
+INSTANTIATE_TEST_CASE_P(ResizeTestFluid_U8_Cubic, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(2))); // error not more than 2 units
+
+INSTANTIATE_TEST_CASE_P(BatchedResizeTestFluid, BatchedResizeTestIE,
+                        Combine(Values(CV_8UC3, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(640, 480), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size(96, 64), cv::Size(160, 120))),
+                                Values(1, 3, 8),
+#if defined(__arm__) || defined(__aarch64__)
+                                Values(4))); // error not more than 4 unit
+#else
+                                Values(1))); // error not more than 1 unit
+#endif
+
+INSTANTIATE_TEST_CASE_P(NormalizeTestFluid, NormalizeTestIE,
+                        Combine(Values(CV_8UC3, CV_32FC3),
+                                Values(InferenceEngine::NCHW, InferenceEngine::NHWC),
+                                Values(std::make_pair(cv::Size(640, 480), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size(96, 64), cv::Size(160, 120))),
+                                Values(0.1))); // 4 units of input range after scaling
+
+INSTANTIATE_TEST_CASE_P(LetterboxTestFluid, LetterboxTestIE,
+                        Combine(Values(CV_8UC3, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_CUBIC),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size(480, 640), cv::Size(300, 300)),
+                                       std::make_pair(cv::Size(320, 240), cv::Size(640, 480)),
+                                       std::make_pair(cv::Size(100, 100), cv::Size(160, 90))),
+                                Values(114.0),
+                                Values(2))); // error not more than 2 units
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -269,7 +305,7 @@ INSTANTIATE_TEST_CASE_P(ColorConvertFluid_4ch, ColorConvertTestIE,
                                 Values(0)));
 
 INSTANTIATE_TEST_CASE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
-                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420),
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420, InferenceEngine::P010),
                                 Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
                                 Values(cv::Size(3840, 2160),
                                        cv::Size(1920, 1080),
@@ -282,6 +318,17 @@ INSTANTIATE_TEST_CASE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
                                        cv::Size( 150,  150)),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(ColorConvertYUV422Fluid, ColorConvertYUV422TestIE,
+                        Combine(Values(InferenceEngine::YUYV, InferenceEngine::UYVY),
+                                Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size(1280,  720),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 320,  200),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 150,  150)),
+                                Values(0)));
+
 INSTANTIATE_TEST_CASE_P(Reorder_HWC2CHW, ColorConvertTestIE,
                         Combine(Values(CV_8U, CV_32F, CV_16S, CV_16F),
                                 Values(InferenceEngine::ColorFormat::BGR),
@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <legacy/graph_tools.hpp>
+#include <legacy/details/ie_cnn_network_tools.h>
+#include "gna_graph_tools.hpp"
+#include "optimizer/gna_pass_manager.hpp"
+#include "gna_matcher.hpp"
+
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+using namespace GNATestIRs;
+
+namespace {
+
+/**
+ * @brief doesn't change the graph, remembers how many layers were attached to it
+ */
+class RecordLayersPass : public BasePass {
+ public:
+    static std::vector<size_t> attachedLayers;
+
+    using BasePass::BasePass;
+    void run() override {
+        attachedLayers.push_back(pLayers->size());
+    }
+    bool runBeforeCopyPass() override { return true; }
+    std::string getName() const override { return "RecordLayers"; }
+};
+std::vector<size_t> RecordLayersPass::attachedLayers;
+
+/**
+ * @brief inserts identity activation after first network input
+ */
+class InsertTestIdentityPass : public BasePass {
+ public:
+    using BasePass::BasePass;
+    void run() override {
+        auto inputData = getPassManager()->getNetwork().getInputsInfo().begin()->second->getInputData();
+        auto input = getCreatorLayer(inputData).lock();
+        auto next = getInputTo(inputData).begin()->second;
+
+        auto identity = std::make_shared<CNNLayer>(LayerParams{"test_identity", "Activation", Precision::FP32});
+        auto data = std::make_shared<Data>("test_identity", inputData->getTensorDesc());
+        getCreatorLayer(data) = identity;
+        identity->outData.push_back(data);
+        CNNNetworkInsertLayer(input, next, identity);
+    }
+    bool runBeforeCopyPass() override { return true; }
+    std::string getName() const override { return "InsertTestIdentity"; }
+};
+
+class CountingRemoveConstPass : public RemoveConstPass {
+ public:
+    static int runs;
+
+    using RemoveConstPass::RemoveConstPass;
+    void run() override {
+        runs++;
+        RemoveConstPass::run();
+    }
+};
+int CountingRemoveConstPass::runs = 0;
+
+/**
+ * @brief same as RemoveConst, but runs regardless of whether graph changed since its previous run
+ */
+class AlwaysRunRemoveConstPass : public CountingRemoveConstPass {
+ public:
+    using CountingRemoveConstPass::CountingRemoveConstPass;
+    bool isTopologyDriven() const override { return false; }
+};
+
+}  // namespace
+
+class GNAPassManagerTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        RecordLayersPass::attachedLayers.clear();
+        CountingRemoveConstPass::runs = 0;
+    }
+
+    static CNNNetwork readNetwork(const std::string & model, size_t weightsSize) {
+        auto weights = make_shared_blob<uint8_t>({ Precision::U8, {weightsSize}, C });
+        weights->allocate();
+        fillWeights(weights, {0.1f, -0.2f, 0.3f});
+
+        Core ie;
+        return CNNNetCopy(ie.ReadNetwork(model, weights));
+    }
+
+    static std::shared_ptr<PassManager> createPassManager(const CNNNetwork & network) {
+        return std::make_shared<PassManager>(PassManagerSettings{Policy(), true, false}, network);
+    }
+
+    /**
+     * @brief part of GNA plugin passes, which are run before network copy, with every RemoveConst replaced by given pass
+     */
+    template <class RemoveConst>
+    static CNNNetwork runPluginPassesBeforeCopy(const std::string & model, size_t weightsSize) {
+        auto network = readNetwork(model, weightsSize);
+        auto passes = createPassManager(network);
+        passes->registerPass<RemoveConst>();
+        passes->registerPass<RemoveConst>();
+        passes->registerPass<UnrollTIPass>();
+        passes->registerPass<RemoveConst>();
+        passes->registerPass<InsertIdentityToLSTMCellPass>();
+        passes->registerPass<UnrollLSTMCellPass>();
+        passes->registerPass<RemoveSingleInputConcatPass>();
+        passes->registerPass<RemoveConst>();
+        passes->run();
+        return network;
+    }
+
+    static void compareGraphs(const CNNNetwork & expected, const CNNNetwork & actual) {
+        auto expectedLayers = details::CNNNetSortTopologically(expected);
+        auto actualLayers = details::CNNNetSortTopologically(actual);
+        ASSERT_EQ(expectedLayers.size(), actualLayers.size());
+        for (size_t i = 0; i < expectedLayers.size(); i++) {
+            auto & e = expectedLayers[i];
+            auto & a = actualLayers[i];
+            ASSERT_EQ(e->name, a->name);
+            ASSERT_EQ(e->type, a->type) << e->name;
+            ASSERT_EQ(e->insData.size(), a->insData.size()) << e->name;
+            for (size_t j = 0; j < e->insData.size(); j++) {
+                ASSERT_EQ(e->insData[j].lock()->getName(), a->insData[j].lock()->getName()) << e->name;
+            }
+            ASSERT_EQ(e->outData.size(), a->outData.size()) << e->name;
+            for (size_t j = 0; j < e->outData.size(); j++) {
+                ASSERT_EQ(e->outData[j]->getName(), a->outData[j]->getName()) << e->name;
+                ASSERT_EQ(e->outData[j]->getDims(), a->outData[j]->getDims()) << e->name;
+                auto & eConsumers = getInputTo(e->outData[j]);
+                auto & aConsumers = getInputTo(a->outData[j]);
+                ASSERT_EQ(eConsumers.size(), aConsumers.size()) << e->name;
+                for (auto eIt = eConsumers.begin(), aIt = aConsumers.begin(); eIt != eConsumers.end(); ++eIt, ++aIt) {
+                    ASSERT_EQ(eIt->first, aIt->first) << e->name;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(GNAPassManagerTest, sortIsReusedWhileGraphIsUnchanged) {
+    auto network = readNetwork(FCOnlyModel(), 440);
+    auto passes = createPassManager(network);
+    passes->registerPass<RecordLayersPass>();
+    passes->registerPass<RecordLayersPass>();
+    passes->registerPass<RecordLayersPass>();
+    passes->run();
+
+    ASSERT_EQ(1u, passes->getSortCount());
+    ASSERT_EQ(std::vector<size_t>({2, 2, 2}), RecordLayersPass::attachedLayers);
+}
+
+TEST_F(GNAPassManagerTest, graphIsSortedAgainAfterItWasChanged) {
+    auto network = readNetwork(FCOnlyModel(), 440);
+    auto passes = createPassManager(network);
+    passes->registerPass<RecordLayersPass>();
+    passes->registerPass<InsertTestIdentityPass>();
+    passes->registerPass<RecordLayersPass>();
+    passes->registerPass<RecordLayersPass>();
+    passes->run();
+
+    ASSERT_EQ(2u, passes->getSortCount());
+    ASSERT_EQ(std::vector<size_t>({2, 3, 3}), RecordLayersPass::attachedLayers);
+    ASSERT_EQ(3u, details::CNNNetSortTopologically(network).size());
+}
+
+TEST_F(GNAPassManagerTest, topologyDrivenPassIsSkippedOnlyOnUnchangedGraph) {
+    auto network = readNetwork(FCOnlyModel(), 440);
+    auto passes = createPassManager(network);
+    passes->registerPass<CountingRemoveConstPass>();
+    passes->registerPass<RecordLayersPass>();
+    passes->registerPass<CountingRemoveConstPass>();
+    passes->registerPass<InsertTestIdentityPass>();
+    passes->registerPass<CountingRemoveConstPass>();
+    passes->run();
+
+    ASSERT_EQ(2, CountingRemoveConstPass::runs);
+}
+
+TEST_F(GNAPassManagerTest, skippedPassesGiveSameGraphAsFullRun) {
+    auto expected = runPluginPassesBeforeCopy<AlwaysRunRemoveConstPass>(TIModelWithLSTMCell2(), 249748);
+    ASSERT_EQ(4, CountingRemoveConstPass::runs);
+
+    CountingRemoveConstPass::runs = 0;
+    auto actual = runPluginPassesBeforeCopy<CountingRemoveConstPass>(TIModelWithLSTMCell2(), 249748);
+    ASSERT_LT(CountingRemoveConstPass::runs, 4);
+
+    compareGraphs(expected, actual);
+}
@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <vector>
 #include <gtest/gtest.h>
 #include <legacy/layer_transform.hpp>
 #include "backend/gna_types.h"
 #include "frontend/model_quantizer.hpp"
 #include "frontend/layer_quantizer.hpp"
+#include "optimizer/gna_pass_manager.hpp"
 #include "gna_matcher.hpp"
 #include <ie_core.hpp>
 
@@ -441,6 +443,111 @@ TEST_F(I16QuantisationTest, TI_quantize) {
     ASSERT_NO_THROW(q.quantize(network, 1000));
 }
 
+namespace {
+
+// passes GNA plugin runs before quantisation of networks without permutations and fake quantize layers
+void runPluginPasses(const CNNNetwork & network, bool runBeforeCopy, bool lowPrecision) {
+    auto passes = std::make_shared<PassManager>(PassManagerSettings{Policy(), runBeforeCopy, lowPrecision}, network);
+    passes->registerPass<RemoveConstPass>();
+    passes->registerPass<UnrollTIPass>();
+    passes->registerPass<RemoveConstPass>();
+    passes->registerPass<InsertIdentityToLSTMCellPass>();
+    passes->registerPass<UnrollLSTMCellPass>();
+    passes->registerPass<RemoveSingleInputConcatPass>();
+    passes->registerPass<SubstitutePReluPass>();
+    passes->registerPass<SubstituteSoftSignPass>();
+    passes->registerPass<ReorderMaxPoolPass>();
+    passes->registerPass<EltwiseSplitOverChannelsPass>();
+    passes->registerPass<InsertSplitAligningFilterPass>();
+    passes->registerPass<FlattenTrivialConcatPass>();
+    passes->registerPass<InsertConcatAligningFilterPass>();
+    passes->registerPass<ReorderConcatInputsPass>();
+    passes->registerPass<InsertIdentityLayerPass>();
+    passes->registerPass<BreakFusingOfOutputLayersPass>();
+    passes->registerPass<InsertCopyLayerPass>();
+    passes->registerPass<InsertDiagonalLayerPass>();
+    passes->registerPass<HandleMultipleActivationsForTheLayerPass>();
+#if GNA_LIB_VER == 2
+    passes->registerPass<ForbidActivationFusingPass>();
+#endif
+    passes->registerPass<SubstituteScaleShiftBroadCastPass>();
+    passes->registerPass<FuseMultipleIdentitiesPass>();
+    passes->registerPass<BroadcastConstPass>();
+    passes->run();
+}
+
+void assertBitExact(float expected, float actual, const std::string & name) {
+    ASSERT_EQ(0, std::memcmp(&expected, &actual, sizeof(float))) << name << ": " << expected << " vs " << actual;
+}
+
+void assertBitExact(const Quantization & expected, const Quantization & actual, const std::string & name) {
+    ASSERT_EQ(expected.IsScaleSet(), actual.IsScaleSet()) << name;
+    assertBitExact(expected.GetScale(), actual.GetScale(), name);
+    ASSERT_EQ(expected.GetLevels(), actual.GetLevels()) << name;
+}
+
+void assertBitExact(const Blob::Ptr & expected, const Blob::Ptr & actual, const std::string & name) {
+    ASSERT_EQ(expected == nullptr, actual == nullptr) << name;
+    if (expected == nullptr) {
+        return;
+    }
+    ASSERT_EQ(expected->getTensorDesc(), actual->getTensorDesc()) << name;
+    ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const uint8_t *>(), actual->cbuffer().as<const uint8_t *>(),
+                             expected->byteSize())) << name;
+}
+
+}  // namespace
+
+TEST_F(I16QuantisationTest, TI_ParallelQuantizationIsSameAsSerial) {
+    auto weights = make_shared_blob<uint8_t>({ Precision::U8, {249748}, C });
+    weights->allocate();
+    fillWeights(weights, {0.1f, -0.37f, 0.9f, -0.05f, 0.6f});
+
+    Core ie;
+    auto network = ie.ReadNetwork(TIModelWithLSTMCell2(), weights);
+
+    auto serialNet = ModelQuantizer<QuantI16>(false).quantize(network, runPluginPasses, 1000);
+    auto parallelNet = ModelQuantizer<QuantI16>(true).quantize(network, runPluginPasses, 1000);
+
+    auto serialLayers = details::CNNNetSortTopologically(serialNet);
+    auto parallelLayers = details::CNNNetSortTopologically(parallelNet);
+    // unrolled cell has independent gates, so some layers are quantized concurrently
+    ASSERT_GT(serialLayers.size(), 10u);
+    ASSERT_EQ(serialLayers.size(), parallelLayers.size());
+    for (size_t i = 0; i < serialLayers.size(); i++) {
+        auto & expected = serialLayers[i];
+        auto & actual = parallelLayers[i];
+        ASSERT_EQ(expected->name, actual->name);
+        ASSERT_EQ(expected->precision, actual->precision) << expected->name;
+
+        auto expectedQuant = getInjectedData<QuantizedLayerParams>(expected);
+        auto actualQuant = getInjectedData<QuantizedLayerParams>(actual);
+        ASSERT_TRUE(expectedQuant != nullptr) << expected->name;
+        ASSERT_TRUE(actualQuant != nullptr) << actual->name;
+        assertBitExact(expectedQuant->_src_quant, actualQuant->_src_quant, expected->name + " src");
+        assertBitExact(expectedQuant->_dst_quant, actualQuant->_dst_quant, expected->name + " dst");
+        assertBitExact(expectedQuant->_weights_quant, actualQuant->_weights_quant, expected->name + " weights");
+        assertBitExact(expectedQuant->_bias_quant, actualQuant->_bias_quant, expected->name + " bias");
+
+        ASSERT_EQ(expected->outData.size(), actual->outData.size()) << expected->name;
+        for (size_t j = 0; j < expected->outData.size(); j++) {
+            ASSERT_EQ(expected->outData[j]->getTensorDesc(), actual->outData[j]->getTensorDesc()) << expected->name;
+        }
+        ASSERT_EQ(expected->blobs.size(), actual->blobs.size()) << expected->name;
+        for (auto && blob : expected->blobs) {
+            ASSERT_EQ(1u, actual->blobs.count(blob.first)) << expected->name;
+            assertBitExact(blob.second, actual->blobs[blob.first], expected->name + " " + blob.first);
+        }
+        auto expectedWeightable = dynamic_cast<WeightableLayer *>(expected.get());
+        auto actualWeightable = dynamic_cast<WeightableLayer *>(actual.get());
+        ASSERT_EQ(expectedWeightable == nullptr, actualWeightable == nullptr) << expected->name;
+        if (expectedWeightable != nullptr) {
+            assertBitExact(expectedWeightable->_weights, actualWeightable->_weights, expected->name + " weights");
+            assertBitExact(expectedWeightable->_biases, actualWeightable->_biases, expected->name + " biases");
+        }
+    }
+}
+
 TEST_F(I16QuantisationTest, TI_PropagateForward) {
 
     assert_that().onInferModel(TIModelWithLSTMCell1()).withWeigthsPattern({0.1f})
@@ -154,6 +154,9 @@ namespace ngraph
                 {
                     m_data = data;
                     constructor_validate_and_infer_types();
+                    // Stops at the first differing element, so pages of mapped data are not
+                    // touched beyond it
+                    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
                 Constant(const Constant& other);
@@ -6,7 +6,9 @@
 
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "ngraph/pass/pass.hpp"
@@ -115,5 +117,23 @@ namespace ngraph
             bool m_visualize = false;
             bool m_per_pass_validation = true;
         };
+
+        /// \brief Enables accumulation of execution times of passes run by any Manager.
+        /// It is also enabled by NGRAPH_PROFILE_PASS_ENABLE environment variable.
+        /// Passes of nested managers are recorded as well, so the time of an enclosing
+        /// pass includes the time of passes it runs.
+        NGRAPH_API
+        void set_pass_profiling_enabled(bool enabled);
+        NGRAPH_API
+        bool get_pass_profiling_enabled();
+
+        /// \return Names of passes with their accumulated execution times in microseconds
+        /// in order of the first execution
+        NGRAPH_API
+        std::vector<std::pair<std::string, int64_t>> get_pass_profile();
+
+        /// \brief Clears execution times accumulated by get_pass_profile()
+        NGRAPH_API
+        void reset_pass_profile();
     } // namespace pass
 } // namespace ngraph
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -36,7 +37,65 @@ namespace ngraph
                 static PerfCounters counters;
                 return counters;
             }
+
+            class PassProfile
+            {
+            public:
+                void add(const std::string& name, int64_t microseconds)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    auto found = m_index.find(name);
+                    if (found == m_index.end())
+                    {
+                        m_index.emplace(name, m_times.size());
+                        m_times.emplace_back(name, microseconds);
+                    }
+                    else
+                    {
+                        m_times[found->second].second += microseconds;
+                    }
+                }
+
+                std::vector<std::pair<std::string, int64_t>> get()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_times;
+                }
+
+                void reset()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_index.clear();
+                    m_times.clear();
+                }
+
+            private:
+                std::mutex m_mutex;
+                std::unordered_map<std::string, size_t> m_index;
+                std::vector<std::pair<std::string, int64_t>> m_times;
+            };
+
+            PassProfile& pass_profile()
+            {
+                static PassProfile profile;
+                return profile;
+            }
+
+            static std::atomic<bool> s_pass_profiling_enabled{getenv_bool("NGRAPH_PROFILE_PASS_ENABLE")};
         } // namespace internal
+
+        void set_pass_profiling_enabled(bool enabled)
+        {
+            internal::s_pass_profiling_enabled = enabled;
+        }
+
+        bool get_pass_profiling_enabled() { return internal::s_pass_profiling_enabled; }
+        std::vector<std::pair<std::string, int64_t>> get_pass_profile()
+        {
+            return internal::pass_profile().get();
+        }
+
+        void reset_pass_profile() { internal::pass_profile().reset(); }
     }     // namespace pass
 } // namespace ngraph
 
@@ -153,6 +212,11 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         }
         index++;
         pass_timer.stop();
+        if (pass::get_pass_profiling_enabled())
+        {
+            pass::internal::pass_profile().add(pass->get_name(),
+                                               static_cast<int64_t>(pass_timer.get_microseconds()));
+        }
         if (profile_enabled)
         {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
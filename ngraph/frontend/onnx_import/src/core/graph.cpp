@@ -2,14 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
 
 #include "core/graph.hpp"
 #include "core/null_node.hpp"
 #include "exceptions.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/provenance.hpp"
@@ -50,6 +56,90 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            /// \brief      Gets the number of threads decoding initializers of a graph.
+            ///
+            /// \note       NGRAPH_ONNX_IMPORT_THREADS environment variable overrides the number
+            ///             of hardware threads, 1 disables concurrent decoding. Values which are
+            ///             not positive numbers are ignored with a warning.
+            static std::size_t get_num_import_threads(std::size_t num_tasks)
+            {
+                const auto hardware_threads =
+                    static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+                int32_t num_threads = hardware_threads;
+                try
+                {
+                    num_threads = getenv_int("NGRAPH_ONNX_IMPORT_THREADS", hardware_threads);
+                }
+                catch (const std::runtime_error& exc)
+                {
+                    NGRAPH_WARN << exc.what();
+                    num_threads = hardware_threads;
+                }
+                if (num_threads < 1)
+                {
+                    NGRAPH_WARN << "NGRAPH_ONNX_IMPORT_THREADS=" << num_threads
+                                << " is ignored, the number of threads has to be positive.";
+                    num_threads = hardware_threads;
+                }
+
+                return std::min(num_tasks, static_cast<std::size_t>(num_threads));
+            }
+
+            /// \brief      Decodes data of the initializers concurrently.
+            ///
+            /// \note       Only data is decoded here. Constant nodes are created afterwards in
+            ///             a single thread, since nGraph graph construction isn't thread-safe and
+            ///             node names have to be the same from run to run.
+            ///
+            /// \param[in]  tensors  The initializers to decode.
+            /// \param[out] data     The decoded data of each initializer.
+            /// \param[out] errors   The exception thrown while decoding each initializer.
+            ///
+            static void
+                decode_initializers(const std::vector<Tensor>& tensors,
+                                    std::vector<std::shared_ptr<Tensor::DecodedBuffer>>& data,
+                                    std::vector<std::exception_ptr>& errors)
+            {
+                data.resize(tensors.size());
+                errors.resize(tensors.size());
+
+                std::atomic<std::size_t> next_index{0};
+                const auto decode = [&]() {
+                    for (auto i = next_index++; i < tensors.size(); i = next_index++)
+                    {
+                        try
+                        {
+                            data[i] = tensors[i].decode_data();
+                        }
+                        catch (...)
+                        {
+                            errors[i] = std::current_exception();
+                        }
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                const auto num_threads = get_num_import_threads(tensors.size());
+                for (std::size_t i = 1; i < num_threads; ++i)
+                {
+                    try
+                    {
+                        workers.emplace_back(decode);
+                    }
+                    catch (const std::system_error&)
+                    {
+                        // The remaining work is shared between already started threads
+                        break;
+                    }
+                }
+                decode();
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
         } // namespace detail
 
         Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
@@ -94,42 +184,58 @@ namespace ngraph
             , m_model{&model}
         {
             std::map<std::string, Tensor> initializers;
-            // Process all initializers in the graph
+            std::vector<Tensor> initializer_tensors;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    std::shared_ptr<default_opset::Constant> ng_constant;
-                    // For each initializer create a Constant node and store it in cache
-                    try
-                    {
-                        ng_constant = tensor.get_ng_constant();
-                    }
-                    catch (const error::invalid_external_data&)
-                    {
-                        // invalid external data makes initializers creation impossible
-                        throw;
-                    }
-                    catch (const ngraph::ngraph_error& exc)
+                    initializer_tensors.emplace_back(initializer_tensor);
+                }
+            }
+
+            std::vector<std::shared_ptr<Tensor::DecodedBuffer>> initializer_data;
+            std::vector<std::exception_ptr> initializer_errors;
+            detail::decode_initializers(
+                initializer_tensors, initializer_data, initializer_errors);
+
+            // Process all initializers in the graph
+            for (std::size_t i = 0; i < initializer_tensors.size(); ++i)
+            {
+                const auto& tensor = initializer_tensors[i];
+                std::shared_ptr<default_opset::Constant> ng_constant;
+                // For each initializer create a Constant node and store it in cache
+                try
+                {
+                    if (initializer_errors[i])
                     {
-                        NGRAPH_WARN
-                            << "\nCould not create an nGraph Constant for initializer '"
-                            << initializer_tensor.name() << "'. \n"
-                            << "Constant with a 0 value was created, make sure connected input is "
-                               "optional.\n"
-                            << "Otherwise verify if the initializer contains a correct number of "
-                               "elements matching the initializer's shape. \n"
-                            << "Detailed error:\n"
-                            << exc.what();
-                        ng_constant =
-                            default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+                        std::rethrow_exception(initializer_errors[i]);
                     }
-
-                    initializers.emplace(initializer_tensor.name(), tensor);
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+                    ng_constant = tensor.get_ng_constant(initializer_data[i]);
+                }
+                catch (const error::invalid_external_data&)
+                {
+                    // invalid external data makes initializers creation impossible
+                    throw;
                 }
+                catch (const ngraph::ngraph_error& exc)
+                {
+                    NGRAPH_WARN << "\nCould not create an nGraph Constant for initializer '"
+                                << tensor.get_name() << "'. \n"
+                                << "Constant with a 0 value was created, make sure connected "
+                                   "input is optional.\n"
+                                << "Otherwise verify if the initializer contains a correct number "
+                                   "of elements matching the initializer's shape. \n"
+                                << "Detailed error:\n"
+                                << exc.what();
+                    ng_constant =
+                        default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+                }
+                // The decoded data is referenced by the Constant from now on
+                initializer_data[i].reset();
+
+                initializers.emplace(tensor.get_name(), tensor);
+                add_provenance_tag_to_initializer(tensor, ng_constant);
+                m_cache->emplace_node(tensor.get_name(), std::move(ng_constant));
             }
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
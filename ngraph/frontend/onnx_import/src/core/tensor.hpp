@@ -4,11 +4,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
+#include "ngraph/check.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -425,6 +431,9 @@ namespace ngraph
         class Tensor
         {
         public:
+            /// \brief      Decoded tensor data, the buffer keeps its owner alive
+            using DecodedBuffer = runtime::SharedBuffer<std::shared_ptr<void>>;
+
             enum class Type
             {
                 undefined = ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED,
@@ -534,43 +543,55 @@ namespace ngraph
 
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
+            {
+                return get_ng_constant(decode_data());
+            }
+
+            /// \brief      Decodes data of the tensor into a buffer matching its shape
+            ///
+            /// \note       Graph nodes are not created here, so different tensors can be
+            ///             decoded concurrently.
+            ///
+            /// \return     Buffer to be referenced by the Constant created with
+            ///             get_ng_constant(data).
+            std::shared_ptr<DecodedBuffer> decode_data() const
             {
                 switch (m_tensor_proto->data_type())
                 {
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
-                    return make_ng_constant<char>(element::boolean);
+                    return decode_data<char>(element::boolean);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                    return make_ng_constant<float>(element::f32);
+                    return decode_data<float>(element::f32);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_FLOAT16:
-                    return make_ng_constant<ngraph::float16>(element::f16);
+                    return decode_data<ngraph::float16>(element::f16);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_DOUBLE:
-                    return make_ng_constant<double>(element::f64);
+                    return decode_data<double>(element::f64);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT8:
-                    return make_ng_constant<int8_t>(element::i8);
+                    return decode_data<int8_t>(element::i8);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT16:
-                    return make_ng_constant<int16_t>(element::i16);
+                    return decode_data<int16_t>(element::i16);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT32:
-                    return make_ng_constant<int32_t>(element::i32);
+                    return decode_data<int32_t>(element::i32);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT64:
-                    return make_ng_constant<int64_t>(element::i64);
+                    return decode_data<int64_t>(element::i64);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_UINT8:
-                    return make_ng_constant<uint8_t>(element::u8);
+                    return decode_data<uint8_t>(element::u8);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_UINT16:
-                    return make_ng_constant<uint16_t>(element::u16);
+                    return decode_data<uint16_t>(element::u16);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_UINT32:
-                    return make_ng_constant<uint32_t>(element::u32);
+                    return decode_data<uint32_t>(element::u32);
                 case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_UINT64:
-                    return make_ng_constant<uint64_t>(element::u64);
+                    return decode_data<uint64_t>(element::u64);
                 default: throw error::tensor::unsupported_data_type{m_tensor_proto->data_type()};
                 }
             }
 
-        private:
-            template <typename T>
-            std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
+            /// \brief      Creates Constant referencing data returned by decode_data()
+            std::shared_ptr<ngraph::op::Constant>
+                get_ng_constant(const std::shared_ptr<DecodedBuffer>& data) const
             {
                 auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                    std::make_shared<ngraph::op::Constant>(get_ng_type(), m_shape, data);
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -578,6 +599,81 @@ namespace ngraph
                 return constant;
             }
 
+        private:
+            template <typename T>
+            std::shared_ptr<DecodedBuffer> decode_data(const element::Type& type) const
+            {
+                auto buffer = decode_raw_data(type);
+                if (buffer)
+                {
+                    return buffer;
+                }
+
+                const auto size = shape_size(m_shape);
+                std::shared_ptr<std::vector<T>> values =
+                    std::make_shared<std::vector<T>>(get_data<T>());
+                NGRAPH_CHECK(values->size() == 1 || values->size() == size,
+                             "Did not get the expected number of literals for a constant of shape ",
+                             m_shape,
+                             " (got ",
+                             values->size(),
+                             ", expected ",
+                             (size == 1 ? "" : "1 or "),
+                             size,
+                             ").");
+                if (values->size() != size)
+                {
+                    // A single value is broadcasted to the whole shape
+                    values->resize(size, values->front());
+                }
+
+                std::shared_ptr<void> owner = values;
+                return std::make_shared<DecodedBuffer>(
+                    reinterpret_cast<char*>(values->data()), size * sizeof(T), owner);
+            }
+
+            /// \brief      Decodes binary data without intermediate copies
+            ///
+            /// \note       External data is mapped into memory and referenced by the buffer,
+            ///             raw data is copied straight to the buffer.
+            ///
+            /// \return     nullptr if binary data doesn't match the shape exactly, e.g. it has
+            ///             to be broadcasted. Typed data has to be converted in this case.
+            std::shared_ptr<DecodedBuffer> decode_raw_data(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+
+                const auto byte_size = shape_size(m_shape) * type.size();
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+                    const auto mapped_buffer = tensor_external_data.load_external_mmap_data();
+                    const auto address = reinterpret_cast<std::uintptr_t>(mapped_buffer->get_ptr());
+                    if (mapped_buffer->size() == byte_size && address % type.size() == 0)
+                    {
+                        std::shared_ptr<void> owner = mapped_buffer;
+                        return std::make_shared<DecodedBuffer>(
+                            mapped_buffer->get_ptr<char>(), byte_size, owner);
+                    }
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == byte_size)
+                {
+                    std::shared_ptr<runtime::AlignedBuffer> aligned_buffer =
+                        std::make_shared<runtime::AlignedBuffer>(byte_size);
+                    std::copy(m_tensor_proto->raw_data().begin(),
+                              m_tensor_proto->raw_data().end(),
+                              aligned_buffer->get_ptr<char>());
+                    std::shared_ptr<void> owner = aligned_buffer;
+                    return std::make_shared<DecodedBuffer>(
+                        aligned_buffer->get_ptr<char>(), byte_size, owner);
+                }
+                return nullptr;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
         };
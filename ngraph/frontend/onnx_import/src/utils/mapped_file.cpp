@@ -0,0 +1,160 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <map>
+#include <mutex>
+
+#include "ngraph/file_util.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+#ifdef _WIN32
+                HANDLE open_file(const std::string& path)
+                {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+                    const auto wide_path = file_util::multi_byte_char_to_wstring(path.c_str());
+                    return CreateFileW(wide_path.c_str(),
+                                       GENERIC_READ,
+                                       FILE_SHARE_READ,
+                                       nullptr,
+                                       OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL,
+                                       nullptr);
+#else
+                    return CreateFileA(path.c_str(),
+                                       GENERIC_READ,
+                                       FILE_SHARE_READ,
+                                       nullptr,
+                                       OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL,
+                                       nullptr);
+#endif
+                }
+#endif
+            } // namespace
+
+            std::shared_ptr<MappedFile> MappedFile::open(const std::string& path)
+            {
+                static std::mutex cache_mutex;
+                static std::map<std::string, std::weak_ptr<MappedFile>> cache;
+
+                std::lock_guard<std::mutex> lock{cache_mutex};
+
+                for (auto it = cache.begin(); it != cache.end();)
+                {
+                    it = it->second.expired() ? cache.erase(it) : std::next(it);
+                }
+
+                const auto cached = cache.find(path);
+                if (cached != cache.end())
+                {
+                    // The last reference may be released by another thread at this moment
+                    if (auto mapped_file = cached->second.lock())
+                    {
+                        return mapped_file;
+                    }
+                }
+
+                std::shared_ptr<MappedFile> mapped_file{new MappedFile()};
+#ifdef _WIN32
+                const auto file = open_file(path);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+
+                // The mapping object keeps the file open, so its handle can be closed right away
+                mapped_file->m_mapping =
+                    CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (mapped_file->m_mapping == nullptr)
+                {
+                    return nullptr;
+                }
+
+                mapped_file->m_data = static_cast<char*>(
+                    MapViewOfFile(mapped_file->m_mapping, FILE_MAP_COPY, 0, 0, 0));
+                if (mapped_file->m_data == nullptr)
+                {
+                    return nullptr;
+                }
+                mapped_file->m_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+                const auto file = ::open(path.c_str(), O_RDONLY);
+                if (file == -1)
+                {
+                    return nullptr;
+                }
+
+                struct stat file_stat;
+                if (fstat(file, &file_stat) == -1 || file_stat.st_size == 0)
+                {
+                    close(file);
+                    return nullptr;
+                }
+
+                // The mapping keeps the file referenced, so the descriptor can be closed right away
+                const auto size = static_cast<std::size_t>(file_stat.st_size);
+                const auto data =
+                    mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+                close(file);
+                if (data == MAP_FAILED)
+                {
+                    return nullptr;
+                }
+
+                mapped_file->m_data = static_cast<char*>(data);
+                mapped_file->m_size = size;
+#endif
+                cache[path] = mapped_file;
+                return mapped_file;
+            }
+
+            MappedFile::~MappedFile()
+            {
+#ifdef _WIN32
+                if (m_data != nullptr)
+                {
+                    UnmapViewOfFile(m_data);
+                }
+                if (m_mapping != nullptr)
+                {
+                    CloseHandle(m_mapping);
+                }
+#else
+                if (m_data != nullptr)
+                {
+                    munmap(m_data, m_size);
+                }
+#endif
+            }
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief  Read-only view of the whole file mapped into memory
+            ///
+            /// \note   Pages are mapped copy-on-write, writes through the view never reach
+            ///         the file. The file is unmapped when the last reference is released.
+            class MappedFile
+            {
+            public:
+                /// \brief      Maps the file or returns its existing mapping
+                ///
+                /// \note       Tensors with data in the same file share a single mapping.
+                ///
+                /// \param[in]  path  Path to the file
+                ///
+                /// \return     Mapping of the file or nullptr if the file can't be mapped
+                static std::shared_ptr<MappedFile> open(const std::string& path);
+
+                ~MappedFile();
+
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+
+                char* data() const { return m_data; }
+                std::size_t size() const { return m_size; }
+
+            private:
+                MappedFile() = default;
+
+                char* m_data = nullptr;
+                std::size_t m_size = 0;
+#ifdef _WIN32
+                void* m_mapping = nullptr;
+#endif
+            };
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
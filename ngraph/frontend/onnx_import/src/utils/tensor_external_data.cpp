@@ -49,13 +49,6 @@ namespace ngraph
                 else
                     read_data_lenght = m_data_lenght;
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -72,6 +65,31 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data() const
+            {
+                auto mapped_file = MappedFile::open(m_data_location);
+                if (!mapped_file || m_offset < 0 || m_data_lenght < 0)
+                    throw error::invalid_external_data{*this};
+
+                const auto offset = static_cast<size_t>(m_offset);
+                if (offset > mapped_file->size())
+                    throw error::invalid_external_data{*this};
+
+                // default value of m_data_lenght is 0 - the data lasts till the end of file
+                const auto length = m_data_lenght == 0 ? mapped_file->size() - offset
+                                                       : static_cast<size_t>(m_data_lenght);
+                if (length > mapped_file->size() - offset)
+                    throw error::invalid_external_data{*this};
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                auto data = mapped_file->data() + offset;
+                return std::make_shared<MappedBuffer>(data, length, mapped_file);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
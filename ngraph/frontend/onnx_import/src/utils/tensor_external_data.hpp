@@ -4,14 +4,20 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "utils/mapped_file.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<MappedFile>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -27,6 +33,15 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       If mapping the external file fails or the data is out of its
+                ///             bounds, the invalid_external_data exception is thrown.
+                ///
+                /// \return     Buffer referencing the mapped data, the file stays mapped
+                ///             while the buffer is alive
+                std::shared_ptr<MappedBuffer> load_external_mmap_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
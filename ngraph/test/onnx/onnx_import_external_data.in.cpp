@@ -89,6 +89,29 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_constants_share_mapped_file)
+{
+    const auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt"));
+
+    std::map<std::string, std::shared_ptr<op::Constant>> constants;
+    for (const auto& op : function->get_ops())
+    {
+        if (const auto constant = as_type_ptr<op::Constant>(op))
+        {
+            constants.emplace(constant->get_friendly_name(), constant);
+        }
+    }
+    ASSERT_EQ(constants.size(), 2u);
+
+    // constants reference data of the same mapped file instead of copies
+    const auto data_a = constants.at("data_a")->get_data_ptr<char>();
+    const auto data_b = constants.at("data_b")->get_data_ptr<char>();
+    EXPECT_EQ(data_b - data_a, 4096);
+    EXPECT_EQ(constants.at("data_b")->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "onnx_import/onnx.hpp"
+
+NGRAPH_SUPPRESS_DEPRECATED_START
+
+using namespace ngraph;
+
+namespace
+{
+    const char* const import_threads_env = "NGRAPH_ONNX_IMPORT_THREADS";
+
+    std::shared_ptr<Function> import_with_threads(const char* num_threads)
+    {
+        set_environment(import_threads_env, num_threads, 1);
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/many_initializers.prototxt"));
+        unset_environment(import_threads_env);
+        return function;
+    }
+
+    void compare_functions(const std::shared_ptr<Function>& expected,
+                           const std::shared_ptr<Function>& actual)
+    {
+        const auto expected_ops = expected->get_ordered_ops();
+        const auto actual_ops = actual->get_ordered_ops();
+        ASSERT_EQ(expected_ops.size(), actual_ops.size());
+
+        for (size_t i = 0; i < expected_ops.size(); ++i)
+        {
+            const auto& e = expected_ops[i];
+            const auto& a = actual_ops[i];
+            ASSERT_EQ(e->get_type_info(), a->get_type_info()) << e->get_friendly_name();
+            ASSERT_EQ(e->get_friendly_name(), a->get_friendly_name());
+            ASSERT_EQ(e->get_output_element_type(0), a->get_output_element_type(0))
+                << e->get_friendly_name();
+            ASSERT_EQ(e->get_output_partial_shape(0), a->get_output_partial_shape(0))
+                << e->get_friendly_name();
+
+            const auto e_const = as_type_ptr<op::Constant>(e);
+            if (e_const)
+            {
+                const auto a_const = as_type_ptr<op::Constant>(a);
+                const auto byte_size =
+                    shape_size(e_const->get_shape()) * e_const->get_element_type().size();
+                ASSERT_EQ(0,
+                          std::memcmp(e_const->get_data_ptr(), a_const->get_data_ptr(), byte_size))
+                    << e->get_friendly_name();
+            }
+        }
+    }
+} // namespace
+
+TEST(onnx_import_initializers, threaded_decoding_equals_serial)
+{
+    const auto serial = import_with_threads("1");
+    ASSERT_EQ(serial->get_ops().size() - serial->get_parameters().size() -
+                  serial->get_results().size(),
+              2u * 48);
+
+    for (const auto num_threads : {"2", "5", "16", "64"})
+    {
+        compare_functions(serial, import_with_threads(num_threads));
+    }
+}
+
+TEST(onnx_import_initializers, constants_have_initializer_values)
+{
+    const auto function = import_with_threads("8");
+
+    size_t num_constants = 0;
+    for (const auto& op : function->get_ops())
+    {
+        const auto constant = as_type_ptr<op::Constant>(op);
+        if (!constant)
+        {
+            continue;
+        }
+        ++num_constants;
+
+        // W0 is the first float initializer, W3 is the first one with raw data, V1 is int64
+        const auto& name = constant->get_friendly_name();
+        if (name == "W0")
+        {
+            EXPECT_EQ(constant->cast_vector<float>(),
+                      (std::vector<float>{-3.0f, -2.75f, -2.5f, -2.25f}));
+        }
+        else if (name == "W3")
+        {
+            EXPECT_EQ(constant->cast_vector<float>(),
+                      (std::vector<float>{0.0f, 0.25f, 0.5f, 0.75f}));
+        }
+        else if (name == "V1")
+        {
+            EXPECT_EQ(constant->cast_vector<int64_t>(),
+                      (std::vector<int64_t>{-4000012, 5000015, -6000018, 7000021}));
+        }
+    }
+    ASSERT_EQ(num_constants, 48u);
+}
+
+TEST(onnx_import_initializers, invalid_number_of_threads_is_ignored)
+{
+    const auto serial = import_with_threads("1");
+
+    for (const auto num_threads : {"0", "-3", "four", "2x", ""})
+    {
+        std::shared_ptr<Function> function;
+        ASSERT_NO_THROW(function = import_with_threads(num_threads)) << num_threads;
+        compare_functions(serial, function);
+    }
+}
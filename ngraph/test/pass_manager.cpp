@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -42,3 +44,126 @@ namespace
         bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override { return false; }
     };
 }
+
+namespace
+{
+    class SleepingPass : public pass::FunctionPass
+    {
+    public:
+        SleepingPass(const std::string& name)
+            : FunctionPass()
+        {
+            set_name(name);
+        }
+        bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            return false;
+        }
+    };
+
+    // Runs the inner pass with its own manager
+    class EnclosingPass : public pass::FunctionPass
+    {
+    public:
+        EnclosingPass()
+            : FunctionPass()
+        {
+            set_name("Enclosing");
+        }
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            pass::Manager manager;
+            manager.set_per_pass_validation(false);
+            manager.register_pass<SleepingPass>("Inner");
+            manager.run_passes(f);
+            return false;
+        }
+    };
+
+    class PassProfilingTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            was_enabled = pass::get_pass_profiling_enabled();
+            pass::reset_pass_profile();
+        }
+
+        void TearDown() override
+        {
+            pass::set_pass_profiling_enabled(was_enabled);
+            pass::reset_pass_profile();
+        }
+
+        bool was_enabled = false;
+    };
+}
+
+TEST_F(PassProfilingTest, disabled_profiling_records_nothing)
+{
+    pass::set_pass_profiling_enabled(false);
+    ASSERT_FALSE(pass::get_pass_profiling_enabled());
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<SleepingPass>("First");
+    manager.run_passes(make_test_graph());
+
+    EXPECT_TRUE(pass::get_pass_profile().empty());
+}
+
+TEST_F(PassProfilingTest, times_are_accumulated_per_pass)
+{
+    pass::set_pass_profiling_enabled(true);
+    ASSERT_TRUE(pass::get_pass_profiling_enabled());
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<SleepingPass>("First");
+    manager.register_pass<SleepingPass>("Second");
+    manager.register_pass<SleepingPass>("First");
+    manager.run_passes(make_test_graph());
+
+    const auto profile = pass::get_pass_profile();
+    ASSERT_EQ(2u, profile.size());
+    EXPECT_EQ("First", profile[0].first);
+    EXPECT_GE(profile[0].second, 4000);
+    EXPECT_EQ("Second", profile[1].first);
+    EXPECT_GE(profile[1].second, 2000);
+}
+
+TEST_F(PassProfilingTest, passes_of_nested_managers_are_recorded)
+{
+    pass::set_pass_profiling_enabled(true);
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<EnclosingPass>();
+    manager.run_passes(make_test_graph());
+
+    // a pass is recorded when it finishes, so the inner pass is the first one
+    const auto profile = pass::get_pass_profile();
+    ASSERT_EQ(2u, profile.size());
+    EXPECT_EQ("Inner", profile[0].first);
+    EXPECT_EQ("Enclosing", profile[1].first);
+    EXPECT_GE(profile[1].second, profile[0].second);
+}
+
+TEST_F(PassProfilingTest, reset_clears_profile)
+{
+    pass::set_pass_profiling_enabled(true);
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<SleepingPass>("First");
+    manager.run_passes(make_test_graph());
+    ASSERT_EQ(1u, pass::get_pass_profile().size());
+
+    pass::reset_pass_profile();
+    EXPECT_TRUE(pass::get_pass_profile().empty());
+
+    manager.run_passes(make_test_graph());
+    ASSERT_EQ(1u, pass::get_pass_profile().size());
+    EXPECT_EQ("First", pass::get_pass_profile()[0].first);
+}
@@ -62,6 +62,27 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn void startTracing()
+         * @ingroup ie_dev_profiling
+         * @brief Starts recording of tasks by the built-in trace collector (ENABLE_PROFILING_TRACE build option),
+         *        which doesn't require Intel VTune.
+         * @details Recording is started at load time if OPENVINO_TRACE_FILE environment variable is set,
+         *          the trace is written to this file at the process exit. The size of per-thread event ring buffers
+         *          can be changed with OPENVINO_TRACE_BUFFER_SIZE environment variable.
+         */
+        void startTracing();
+
+        /**
+         * @fn bool dumpTrace(const std::string& path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes tasks recorded by the built-in trace collector to @p path in Chrome trace JSON format,
+         *        which can be opened by chrome://tracing or Perfetto UI.
+         * @param path [in] The output file path
+         * @return false if the collector isn't built in or the file can't be written
+         */
+        bool dumpTrace(const std::string& path);
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
@@ -9,11 +9,16 @@
 #include <ittnotify.h>
 #endif
 
+#ifdef ENABLE_PROFILING_TRACE
+#include "trace_collector.hpp"
+#include <mutex>
+#endif
+
 namespace openvino {
 namespace itt {
 namespace internal {
 
-#ifdef ENABLE_PROFILING_ITT
+#if defined(ENABLE_PROFILING_ITT) || defined(ENABLE_PROFILING_TRACE)
 
 static size_t callStackDepth() {
     static const char *env = std::getenv("OPENVINO_TRACE_DEPTH");
@@ -23,6 +28,71 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+#endif
+
+#if defined(ENABLE_PROFILING_TRACE)
+
+// Domains and handles are interned names, which keep ITT objects if ITT is enabled as well
+
+#ifdef ENABLE_PROFILING_ITT
+static std::mutex itt_objects_guard;
+#endif
+
+domain_t domain(char const* name) {
+    auto d = trace::intern(name, true);
+#ifdef ENABLE_PROFILING_ITT
+    std::lock_guard<std::mutex> lock(itt_objects_guard);
+    if (!d->itt)
+        d->itt = __itt_domain_create(name);
+#endif
+    return reinterpret_cast<domain_t>(d);
+}
+
+handle_t handle(char const* name) {
+    auto h = trace::intern(name, false);
+#ifdef ENABLE_PROFILING_ITT
+    std::lock_guard<std::mutex> lock(itt_objects_guard);
+    if (!h->itt)
+        h->itt = __itt_string_handle_create(name);
+#endif
+    return reinterpret_cast<handle_t>(h);
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth()) {
+        auto dn = reinterpret_cast<const trace::Name*>(d);
+        auto tn = reinterpret_cast<const trace::Name*>(t);
+#ifdef ENABLE_PROFILING_ITT
+        __itt_task_begin(reinterpret_cast<__itt_domain*>(dn->itt),
+                         __itt_null,
+                         __itt_null,
+                         reinterpret_cast<__itt_string_handle*>(tn->itt));
+#endif
+        if (trace::enabled())
+            trace::begin(dn, tn);
+    }
+}
+
+void taskEnd(domain_t d) {
+    if (!callStackDepth() || --call_stack_depth < callStackDepth()) {
+        auto dn = reinterpret_cast<const trace::Name*>(d);
+#ifdef ENABLE_PROFILING_ITT
+        __itt_task_end(reinterpret_cast<__itt_domain*>(dn->itt));
+#endif
+        if (trace::enabled())
+            trace::end(dn);
+    }
+}
+
+void threadName(const char* name) {
+#ifdef ENABLE_PROFILING_ITT
+    __itt_thread_set_name(name);
+#endif
+    trace::threadName(name);
+}
+
+#elif defined(ENABLE_PROFILING_ITT)
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
@@ -63,5 +133,24 @@ void threadName(const char *) { }
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
+
+#ifdef ENABLE_PROFILING_TRACE
+
+void startTracing() {
+    trace::enable();
+}
+
+bool dumpTrace(const std::string& path) {
+    return trace::dump(path);
+}
+
+#else
+
+void startTracing() { }
+
+bool dumpTrace(const std::string&) { return false; }
+
+#endif  // ENABLE_PROFILING_TRACE
+
 }  // namespace itt
 }  // namespace openvino
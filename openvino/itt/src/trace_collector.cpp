@@ -0,0 +1,273 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "trace_collector.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+namespace {
+
+struct Event {
+    uint64_t timestamp;     // nanoseconds since the collector creation
+    const Name* domain;
+    const Name* task;       // nullptr for the end of the task
+};
+
+/**
+ * Single producer (the owning thread) ring buffer. The oldest events are overwritten when it is full.
+ * The producer never blocks, a reader may see a few torn events at the overwrite boundary if it dumps
+ * while the thread is running.
+ */
+class ThreadBuffer {
+public:
+    ThreadBuffer(size_t capacityPow2, uint32_t id) : events(capacityPow2), mask(capacityPow2 - 1), id(id) {}
+
+    void push(const Event& event) {
+        const uint64_t pos = written.load(std::memory_order_relaxed);
+        events[pos & mask] = event;
+        written.store(pos + 1, std::memory_order_release);
+    }
+
+    std::vector<Event> snapshot() const {
+        if (retired)
+            return events;
+        const uint64_t end = written.load(std::memory_order_acquire);
+        const uint64_t begin = end > events.size() ? end - events.size() : 0;
+        std::vector<Event> result;
+        result.reserve(end - begin);
+        for (uint64_t pos = begin; pos < end; pos++)
+            result.push_back(events[pos & mask]);
+        return result;
+    }
+
+    // Called when the owning thread exits: the ring is replaced with just the recorded events
+    void retire() {
+        std::vector<Event> recorded = snapshot();
+        events.swap(recorded);
+        retired = true;
+    }
+
+    std::vector<Event> events;
+    const uint64_t mask;
+    const uint32_t id;
+    std::atomic<uint64_t> written{0};
+    std::string name;       // guarded by the collector mutex
+    bool retired = false;   // guarded by the collector mutex
+};
+
+/**
+ * Drops events which have no pair in the buffer: ends of tasks whose beginning was overwritten
+ * and beginnings of tasks which haven't ended yet, so the trace contains only complete tasks.
+ */
+std::vector<Event> balanced(const std::vector<Event>& events) {
+    std::vector<bool> keep(events.size(), false);
+    std::vector<size_t> open;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i].task) {
+            open.push_back(i);
+        } else if (!open.empty()) {
+            keep[open.back()] = true;
+            keep[i] = true;
+            open.pop_back();
+        }
+    }
+
+    std::vector<Event> result;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (keep[i])
+            result.push_back(events[i]);
+    }
+    return result;
+}
+
+// Hands the buffer back to the collector when the thread exits
+struct ThreadBufferOwner {
+    ~ThreadBufferOwner();
+    ThreadBuffer* buffer = nullptr;
+};
+
+thread_local ThreadBufferOwner currentBuffer;
+thread_local std::string currentThreadName;
+
+class Collector {
+public:
+    static Collector& instance() {
+        // never destroyed, so it may be used by other static objects during the process exit
+        static Collector* collector = new Collector();
+        return *collector;
+    }
+
+    Name* intern(const char* name, bool isDomain) {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& names = isDomain ? domains : tasks;
+        auto& result = names[name];
+        if (!result) {
+            result.reset(new Name());
+            result->str = name;
+        }
+        return result.get();
+    }
+
+    ThreadBuffer& threadBuffer() {
+        if (!currentBuffer.buffer) {
+            std::lock_guard<std::mutex> lock(guard);
+            buffers.emplace_back(new ThreadBuffer(capacity, static_cast<uint32_t>(buffers.size() + 1)));
+            currentBuffer.buffer = buffers.back().get();
+            currentBuffer.buffer->name = currentThreadName;
+        }
+        return *currentBuffer.buffer;
+    }
+
+    // the ring of an exited thread is freed, only its events are kept for the dump
+    void retire(ThreadBuffer& buffer) {
+        std::lock_guard<std::mutex> lock(guard);
+        buffer.retire();
+    }
+
+    uint64_t now() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+
+    // buffers are allocated on the first event, so naming of threads doesn't consume memory if tracing is off
+    void setThreadName(const char* name) {
+        currentThreadName = name;
+        if (currentBuffer.buffer) {
+            std::lock_guard<std::mutex> lock(guard);
+            currentBuffer.buffer->name = name;
+        }
+    }
+
+    bool dump(const std::string& path) {
+        std::unique_ptr<FILE, int(*)(FILE*)> file(std::fopen(path.c_str(), "w"), &std::fclose);
+        if (!file)
+            return false;
+
+        std::lock_guard<std::mutex> lock(guard);
+        std::fputs("{\"traceEvents\":[\n", file.get());
+        bool first = true;
+        auto separator = [&] {
+            if (!first)
+                std::fputs(",\n", file.get());
+            first = false;
+        };
+
+        for (const auto& buffer : buffers) {
+            if (!buffer->name.empty()) {
+                separator();
+                std::fprintf(file.get(), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                             buffer->id, escape(buffer->name).c_str());
+            }
+            for (const auto& event : balanced(buffer->snapshot())) {
+                separator();
+                if (event.task) {
+                    std::fprintf(file.get(), "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                                 escape(event.task->str).c_str(), escape(event.domain->str).c_str(),
+                                 buffer->id, event.timestamp / 1000.0);
+                } else {
+                    std::fprintf(file.get(), "{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                                 buffer->id, event.timestamp / 1000.0);
+                }
+            }
+        }
+        std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file.get());
+        return std::ferror(file.get()) == 0;
+    }
+
+    std::atomic<bool> enabled{false};
+
+private:
+    Collector() : start(std::chrono::steady_clock::now()) {
+        if (const char* size = std::getenv("OPENVINO_TRACE_BUFFER_SIZE")) {
+            const size_t requested = std::strtoul(size, nullptr, 10);
+            while (capacity < requested)
+                capacity <<= 1;
+        }
+        if (std::getenv("OPENVINO_TRACE_FILE")) {
+            enabled = true;
+            std::atexit([] {
+                Collector::instance().dump(std::getenv("OPENVINO_TRACE_FILE"));
+            });
+        }
+    }
+
+    static std::string escape(const std::string& str) {
+        std::string result;
+        for (char c : str) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", c);
+                result += code;
+            } else {
+                result += c;
+            }
+        }
+        return result;
+    }
+
+    const std::chrono::steady_clock::time_point start;
+    size_t capacity = 1 << 16;
+    std::mutex guard;
+    std::unordered_map<std::string, std::unique_ptr<Name>> domains;
+    std::unordered_map<std::string, std::unique_ptr<Name>> tasks;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+ThreadBufferOwner::~ThreadBufferOwner() {
+    if (buffer)
+        Collector::instance().retire(*buffer);
+    buffer = nullptr;
+}
+
+}  // namespace
+
+Name* intern(const char* name, bool isDomain) {
+    return Collector::instance().intern(name, isDomain);
+}
+
+bool enabled() {
+    return Collector::instance().enabled.load(std::memory_order_relaxed);
+}
+
+void enable() {
+    Collector::instance().enabled = true;
+}
+
+void begin(const Name* domain, const Name* task) {
+    auto& collector = Collector::instance();
+    collector.threadBuffer().push({collector.now(), domain, task});
+}
+
+void end(const Name* domain) {
+    auto& collector = Collector::instance();
+    collector.threadBuffer().push({collector.now(), domain, nullptr});
+}
+
+void threadName(const char* name) {
+    Collector::instance().setThreadName(name);
+}
+
+bool dump(const std::string& path) {
+    return Collector::instance().dump(path);
+}
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief In-process collector of ITT tasks which doesn't require Intel VTune.
+ * Begin/end events are stored in per-thread ring buffers and written in Chrome trace JSON format,
+ * which can be opened by chrome://tracing or https://ui.perfetto.dev
+ * @file trace_collector.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+/**
+ * @brief Interned domain or task name. The objects are never destroyed, so pointers stay valid
+ * until the process exit.
+ */
+struct Name {
+    std::string str;
+    void* itt = nullptr;    // corresponding ITT object if ITT is enabled as well
+};
+
+/**
+ * @brief Returns unique object for the given name. Is thread safe.
+ */
+Name* intern(const char* name, bool isDomain);
+
+/**
+ * @brief Returns true if events are being recorded.
+ * Recording is enabled by OPENVINO_TRACE_FILE environment variable (the trace is written to the file at exit)
+ * or by enable() call.
+ */
+bool enabled();
+
+void enable();
+
+void begin(const Name* domain, const Name* task);
+
+void end(const Name* domain);
+
+void threadName(const char* name);
+
+/**
+ * @brief Writes the recorded events to the file in Chrome trace JSON format. Only complete tasks are written,
+ * tasks which are still running or whose beginning was overwritten in the ring buffer are skipped.
+ * @return false if the file can't be written
+ */
+bool dump(const std::string& path);
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
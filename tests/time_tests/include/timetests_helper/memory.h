@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace TimeTest {
+
+/**
+ * @brief Get peak resident set size (memory high-water mark) of the current process
+ * @return peak RSS in kilobytes or 0 if it isn't available
+ */
+size_t getVmHWM();
+
+/**
+ * @brief Get peak virtual memory size of the current process
+ * @return peak virtual memory size in kilobytes or 0 if it isn't available
+ */
+size_t getVmPeak();
+
+/**
+ * @brief Reset peak resident set size to the current one, so the next getVmHWM() call
+ * reports the high-water mark of a following phase only
+ * @return false if the system doesn't support reset (peak of the whole run is reported then)
+ */
+bool resetVmHWM();
+
+} // namespace TimeTest
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace TimeTest {
@@ -29,4 +30,9 @@ public:
 
 #define SCOPED_TIMER(timer_name) TimeTest::Timer timer_name(#timer_name);
 
+/// Reports a value measured by other means than Timer (memory usage, durations
+/// provided by a plugin, etc) to the same statistics file. The value is
+/// written as an integer, so large values don't lose digits.
+void reportValue(const std::string &name, int64_t value);
+
 } // namespace TimeTest
\ No newline at end of file
@@ -0,0 +1,241 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+#include "common.h"
+#include "timetests_helper/memory.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Replace characters which are not allowed in statistics names
+ */
+static std::string statisticsName(std::string name) {
+  std::replace_if(name.begin(), name.end(), [](char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != '_'; }, '_');
+  return name;
+}
+
+/**
+ * @brief Report memory high-water marks of the finished phase and reset them
+ * for the next one
+ */
+static void reportMemory(const std::string &phase) {
+  TimeTest::reportValue(phase + "_vmhwm_kb", static_cast<int64_t>(TimeTest::getVmHWM()));
+  TimeTest::reportValue(phase + "_vmpeak_kb", static_cast<int64_t>(TimeTest::getVmPeak()));
+  TimeTest::resetVmHWM();
+}
+
+/**
+ * @brief Report durations of ngraph passes executed since the previous call
+ */
+static void reportPassProfile(const std::string &prefix) {
+  for (const auto &pass : ngraph::pass::get_pass_profile())
+    TimeTest::reportValue(prefix + statisticsName(pass.first), pass.second);
+  ngraph::pass::reset_pass_profile();
+}
+
+/**
+ * @brief Report durations of LoadNetwork phases provided by a plugin
+ */
+static void reportPluginLoadTime(const ExecutableNetwork &exeNetwork) {
+  // the metric is internal, so it isn't listed in SUPPORTED_METRICS and other plugins throw
+  std::map<std::string, double> phases;
+  try {
+    phases = exeNetwork.GetMetric(PluginConfigInternalParams::METRIC_CPU_LOAD_TIME_BREAKDOWN).as<std::map<std::string, double>>();
+  } catch (const std::exception &) {
+    return;
+  }
+  for (const auto &phase : phases)
+    TimeTest::reportValue("plugin_" + statisticsName(phase.first), std::llround(phase.second * 1000));
+}
+
+/**
+ * @brief Read whole file into a string
+ */
+static std::string readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+    IE_THROW() << "Cannot open " << path;
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+/**
+ * @brief Read whole file into a blob
+ */
+static Blob::Ptr readBlob(const std::string &path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file)
+    IE_THROW() << "Cannot open " << path;
+  const size_t size = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+  auto blob = make_shared_blob<uint8_t>({Precision::U8, {size}, Layout::C});
+  blob->allocate();
+  if (!file.read(blob->buffer().as<char *>(), size))
+    IE_THROW() << "Cannot read " << path;
+  return blob;
+}
+
+/**
+ * @brief Model cache directory unique for the run, so the first load always
+ * fills the cache. The directory is removed with its content on destruction.
+ */
+class TemporaryCacheDir {
+public:
+  TemporaryCacheDir() {
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    path = "compile_breakdown_cache_" + std::to_string(pid) + "_" + std::to_string(now);
+  }
+
+  ~TemporaryCacheDir() {
+    // the cache directory is flat, it contains compiled network files only
+#ifdef _WIN32
+    WIN32_FIND_DATAA entry;
+    HANDLE find = FindFirstFileA((path + "\\*").c_str(), &entry);
+    if (find != INVALID_HANDLE_VALUE) {
+      do {
+        if (!(entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+          DeleteFileA((path + "\\" + entry.cFileName).c_str());
+      } while (FindNextFileA(find, &entry));
+      FindClose(find);
+    }
+    RemoveDirectoryA(path.c_str());
+#else
+    if (DIR *dir = opendir(path.c_str())) {
+      while (dirent *entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name != "." && name != "..")
+          unlink((path + "/" + name).c_str());
+      }
+      closedir(dir);
+    }
+    rmdir(path.c_str());
+#endif
+  }
+
+  std::string path;
+};
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    ngraph::pass::set_pass_profiling_enabled(true);
+    ngraph::pass::reset_pass_profile();
+    TimeTest::resetVmHWM();
+
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+
+    {
+      SCOPED_TIMER(load_plugin);
+      ie.GetVersions(device);
+    }
+    reportMemory("load_plugin");
+
+    {
+      SCOPED_TIMER(read_network);
+      if (TimeTest::fileExt(model) == "xml") {
+        std::string xml;
+        Blob::Ptr weights;
+        {
+          SCOPED_TIMER(read_xml);
+          xml = readFile(model);
+        }
+        {
+          SCOPED_TIMER(read_weights);
+          weights = readBlob(model.substr(0, model.rfind('.')) + ".bin");
+        }
+        {
+          SCOPED_TIMER(parse_network);
+          cnnNetwork = ie.ReadNetwork(xml, weights);
+        }
+      } else {
+        cnnNetwork = ie.ReadNetwork(model);
+      }
+    }
+    reportMemory("read_network");
+    reportPassProfile("read_network_pass_");
+
+    {
+      SCOPED_TIMER(load_network);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+    reportMemory("load_network");
+    reportPassProfile("pass_");
+    reportPluginLoadTime(exeNetwork);
+
+    exeNetwork = {};
+    cnnNetwork = {};
+    ngraph::pass::set_pass_profiling_enabled(false);
+    TimeTest::resetVmHWM();
+
+    // the first load fills the empty cache, the second one imports the
+    // compiled network by a fresh Core as a cold started application does
+    TemporaryCacheDir cacheDir;
+    const std::map<std::string, std::string> cacheConfig = {{CONFIG_KEY(CACHE_DIR), cacheDir.path}};
+    {
+      Core cacheIe;
+      cacheIe.SetConfig(cacheConfig);
+      SCOPED_TIMER(cache_fill);
+      cacheIe.LoadNetwork(model, device);
+    }
+    TimeTest::resetVmHWM();
+    {
+      Core cacheIe;
+      cacheIe.SetConfig(cacheConfig);
+      SCOPED_TIMER(cache_import);
+      exeNetwork = cacheIe.LoadNetwork(model, device);
+    }
+    reportMemory("cache_import");
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
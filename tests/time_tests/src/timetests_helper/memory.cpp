@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timetests_helper/memory.h"
+
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace TimeTest {
+
+#ifdef _WIN32
+
+size_t getVmHWM() {
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0;
+  return counters.PeakWorkingSetSize / 1024;
+}
+
+size_t getVmPeak() {
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0;
+  return counters.PeakPagefileUsage / 1024;
+}
+
+bool resetVmHWM() {
+  return false;
+}
+
+#else
+
+/**
+ * @brief Read "<field>: <value> kB" line from /proc/self/status
+ */
+static size_t getProcStatusValue(const std::string &field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size() + 1, field + ":") == 0)
+      return std::stoul(line.substr(field.size() + 1));
+  }
+  return 0;
+}
+
+size_t getVmHWM() {
+  size_t value = getProcStatusValue("VmHWM");
+  if (value == 0) {
+    // no procfs, the peak is reported by getrusage in kilobytes (in bytes on macOS)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+      value = usage.ru_maxrss / 1024;
+#else
+      value = usage.ru_maxrss;
+#endif
+    }
+  }
+  return value;
+}
+
+size_t getVmPeak() {
+  return getProcStatusValue("VmPeak");
+}
+
+bool resetVmHWM() {
+  // "5" resets the peak RSS of the process (Linux 4.0+)
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  if (!clearRefs)
+    return false;
+  clearRefs << "5";
+  clearRefs.flush();
+  return clearRefs.good();
+}
+
+#endif
+
+} // namespace TimeTest
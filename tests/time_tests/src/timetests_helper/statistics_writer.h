@@ -54,4 +54,13 @@ public:
       throw std::runtime_error("Statistic file path isn't set");
     statistics_file << record.first << ": " << record.second << "\n";
   }
+
+  /**
+   * @brief Writes provided statistics with already formatted value.
+   */
+  void write(const std::string &name, const std::string &value) {
+    if (!statistics_file)
+      throw std::runtime_error("Statistic file path isn't set");
+    statistics_file << name << ": " << value << "\n";
+  }
 };
@@ -26,4 +26,8 @@ Timer::~Timer() {
   StatisticsWriter::Instance().write({name, duration});
 }
 
+void reportValue(const std::string &name, int64_t value) {
+  StatisticsWriter::Instance().write(name, std::to_string(value));
+}
+
 } // namespace TimeTest
\ No newline at end of file